@@ -31,6 +31,7 @@
 #include <concepts>
 #include <ranges>
 #include <cassert>
+#include <memory>
 
 //*************************************************************
 // class belleviews::ref_view
@@ -43,7 +44,7 @@
 // OPEN/TODO:
 // - ...
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 template<std::ranges::range Rg>
 requires std::is_object_v<Rg>
@@ -90,9 +91,13 @@ class ref_view : public std::ranges::view_interface<ref_view<Rg>>
     return std::ranges::size(*rgPtr); 
   }
 
-  constexpr auto data() const requires std::ranges::contiguous_range<Rg> {
+  // data():
+  constexpr auto data() requires std::ranges::contiguous_range<Rg> {
     return std::ranges::data(*rgPtr);
   }
+  constexpr auto data() const requires std::ranges::contiguous_range<Rg> {
+    return std::ranges::cdata(*rgPtr);
+  }
 };
 
 template<typename Rg>
@@ -116,7 +121,7 @@ inline constexpr bool std::ranges::enable_borrowed_range<belleviews::ref_view<Rg
 // OPEN/TODO:
 // - ...
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 template<std::ranges::range Rg>
 requires std::movable<Rg> && (!_intern::is_initializer_list<std::remove_cv_t<Rg>>)
@@ -193,6 +198,139 @@ inline constexpr bool std::ranges::enable_borrowed_range<belleviews::owning_view
   
 
 
+//*************************************************************
+// class belleviews::shared_view
+// 
+// A C++ view
+// sharing the ownership of an immutable range
+// (to hand over owned data to multiple threads without copying the data)
+// with the following benefits compared to C++ standard views
+// - Copies are cheap (O(1), the range is reference counted)
+// - Iterating is stateless
+//   - Can iterate over elements when the view is const
+//   - Supports concurrent iterations (in any thread)
+// - Always propagates const
+// Because
+// - The range is immutable: this view always yields const iterators
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<std::ranges::range Rg>
+requires std::ranges::range<const Rg> && std::is_object_v<Rg> && (!std::ranges::view<Rg>)
+class shared_view : public std::ranges::view_interface<shared_view<Rg>>
+{
+ private:
+   // never null (also not after moves, which are copies):
+   std::shared_ptr<const Rg> rgPtr;
+
+ public:
+   shared_view() requires std::default_initializable<Rg>
+    : rgPtr(std::make_shared<const Rg>()) {
+   }
+
+   explicit shared_view(Rg&& rg)
+    : rgPtr(std::make_shared<const Rg>(std::move(rg))) {
+   }
+
+   explicit shared_view(std::shared_ptr<const Rg> ptr)
+    : rgPtr(std::move(ptr)) {
+     assert(rgPtr);
+   }
+
+   // no move operations, so that moving copies:
+   shared_view(const shared_view&) = default;
+   shared_view& operator=(const shared_view&) = default;
+
+   const Rg& base() const noexcept { return *rgPtr; }
+
+   // number of views sharing the range:
+   long use_count() const noexcept { return rgPtr.use_count(); }
+
+   // begin() and end() (always const):
+   auto begin() const {
+     return std::make_const_iterator(std::ranges::begin(*rgPtr));
+   }
+   auto end() const {
+     return std::make_const_sentinel(std::ranges::end(*rgPtr));
+   }
+
+   // empty() and size():
+   bool empty() const requires requires { std::ranges::empty(*rgPtr); } {
+     return std::ranges::empty(*rgPtr);
+   }
+   auto size() const requires std::ranges::sized_range<const Rg> {
+     return std::ranges::size(*rgPtr);
+   }
+
+   // data():
+   auto data() const requires std::ranges::contiguous_range<const Rg> {
+     return std::ranges::cdata(*rgPtr);
+   }
+};
+
+template<typename Rg>
+shared_view(Rg&&) -> shared_view<Rg>;
+
+} // namespace belleviews
+
+// NO BORROWED VIEW (the last view owns the range):
+//template<typename Rg>
+//inline constexpr bool std::ranges::enable_borrowed_range<belleviews::shared_view<Rg>> = false;
+
+
+//*************************************************************
+// belleviews::share()
+// bel::views::share()
+// 
+// A C++ shared_view adaptor for the belleviews::shared_view
+// - only for rvalues (moves the range into the shared buffer)
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename Rg>
+  concept can_shared_view = !std::is_lvalue_reference_v<Rg>
+                            && requires { shared_view(std::declval<Rg>()); };
+}
+
+struct Share {
+   // for:  bel::views::share(rg)
+   template<typename Rg>
+   requires _intern::can_shared_view<Rg>
+   auto
+   operator() [[nodiscard]] (Rg&& rg) const {
+     return shared_view{std::move(rg)};
+   }
+
+   // for:  rg | bel::views::share()
+   struct PartialShare {
+   };
+
+   constexpr auto
+   operator() [[nodiscard]] () const {
+     return PartialShare{};
+   }
+
+   template<typename Rg>
+   requires _intern::can_shared_view<Rg>
+   friend auto
+   operator| (Rg&& rg, PartialShare) {
+     return shared_view{std::move(rg)};
+   }
+};
+
+// belleviews::share :
+inline constexpr Share share;
+
+} // namespace belleviews
+
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::share :
+  inline constexpr belleviews::Share share;
+}
+
+
 //*************************************************************
 // belleviews::all()
 // bel::views::all()
@@ -200,7 +338,7 @@ inline constexpr bool std::ranges::enable_borrowed_range<belleviews::owning_view
 // 
 // A C++ view adaptor for different belleviews views
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 namespace _intern {
   template<typename Rg>
@@ -239,7 +377,7 @@ template<std::ranges::viewable_range Rg>
 } // namespace belleviews
 
 
-namespace bel::views {
+BELLEVIEWS_EXPORT namespace bel::views {
 
   // bel::views::all() :
   inline constexpr belleviews::All all;
@@ -0,0 +1,367 @@
+// <belleanyview.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+// If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef BELLEANYVIEW_HPP
+#define BELLEANYVIEW_HPP
+
+#include <concepts>
+#include <ranges>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+//*************************************************************
+// internal helpers for type erasure
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+
+  // SboPtr<Base>:
+  // - owns an object of a class derived from Base
+  // - small-buffer optimization: stores small nothrow movable objects inline
+  //   (these have to implement: Base* moveTo(void* buf) noexcept)
+  inline constexpr std::size_t sboSize = 4 * sizeof(void*);
+
+  template<typename Base>
+  class SboPtr
+  {
+   private:
+    alignas(std::max_align_t) std::byte buf_[sboSize];
+    Base* ptr_ = nullptr;
+    bool local_ = false;
+
+    void moveFrom(SboPtr& rhs) noexcept {
+      if (rhs.local_) {
+        ptr_ = rhs.ptr_->moveTo(buf_);
+        local_ = true;
+        rhs.reset();
+      }
+      else {
+        ptr_ = std::exchange(rhs.ptr_, nullptr);
+        local_ = false;
+      }
+    }
+
+   public:
+    template<typename Impl>
+    static constexpr bool fitsLocally = sizeof(Impl) <= sboSize
+                                        && alignof(Impl) <= alignof(std::max_align_t)
+                                        && std::is_nothrow_move_constructible_v<Impl>;
+
+    SboPtr() = default;
+    SboPtr(SboPtr&& rhs) noexcept {
+      moveFrom(rhs);
+    }
+    SboPtr& operator=(SboPtr&& rhs) noexcept {
+      if (this != &rhs) {
+        reset();
+        moveFrom(rhs);
+      }
+      return *this;
+    }
+    ~SboPtr() {
+      reset();
+    }
+
+    template<std::derived_from<Base> Impl, typename... Args>
+    void emplace(Args&&... args) {
+      reset();
+      if constexpr (fitsLocally<Impl>) {
+        ptr_ = ::new (static_cast<void*>(buf_)) Impl(std::forward<Args>(args)...);
+        local_ = true;
+      }
+      else {
+        ptr_ = new Impl(std::forward<Args>(args)...);
+        local_ = false;
+      }
+    }
+
+    void reset() noexcept {
+      if (local_) {
+        ptr_->~Base();
+      }
+      else {
+        delete ptr_;
+      }
+      ptr_ = nullptr;
+      local_ = false;
+    }
+
+    Base* operator->() const noexcept { return ptr_; }
+    Base& operator*() const noexcept { return *ptr_; }
+    explicit operator bool() const noexcept { return ptr_ != nullptr; }
+  };
+
+  // erased iteration state (position and end):
+  template<typename T>
+  struct AnyCursorBase {
+    virtual ~AnyCursorBase() = default;
+    virtual AnyCursorBase* moveTo(void* buf) noexcept = 0;
+    // copy the next up to block.size() elements into block and return their number
+    // (0 at the end):
+    virtual std::size_t next_block(std::span<T> block) = 0;
+  };
+
+  template<typename T, typename Rg>
+  struct AnyCursor : AnyCursorBase<T> {
+    std::ranges::iterator_t<Rg> current_;
+    std::ranges::sentinel_t<Rg> end_;
+
+    AnyCursor(std::ranges::iterator_t<Rg> beg, std::ranges::sentinel_t<Rg> end)
+     : current_(std::move(beg)), end_(std::move(end)) {
+    }
+    AnyCursorBase<T>* moveTo(void* buf) noexcept override {
+      return ::new (buf) AnyCursor(std::move(*this));
+    }
+    std::size_t next_block(std::span<T> block) override {
+      std::size_t num = 0;
+      for (; num < block.size() && current_ != end_; ++current_, ++num) {
+        block[num] = *current_;
+      }
+      return num;
+    }
+  };
+
+  // cursor iterating over its own copy of a view that is not const-iterable
+  // (the copy is on the heap because the iterators might refer to the view):
+  template<typename T, typename V>
+  struct AnyCopyCursor : AnyCursorBase<T> {
+    std::unique_ptr<V> view_;
+    AnyCursor<T, V> cursor_;
+
+    explicit AnyCopyCursor(std::unique_ptr<V> vw)
+     : view_(std::move(vw)), cursor_(std::ranges::begin(*view_), std::ranges::end(*view_)) {
+    }
+    AnyCursorBase<T>* moveTo(void* buf) noexcept override {
+      return ::new (buf) AnyCopyCursor(std::move(*this));
+    }
+    std::size_t next_block(std::span<T> block) override {
+      return cursor_.next_block(block);
+    }
+  };
+
+  // views with elements convertible to T can be erased:
+  template<typename V, typename T>
+  concept any_viewable = std::ranges::input_range<V>
+                         && std::convertible_to<std::ranges::range_reference_t<V>, T>;
+
+  // erased view:
+  template<typename T>
+  struct AnyViewBase {
+    virtual ~AnyViewBase() = default;
+    virtual AnyViewBase* moveTo(void* buf) noexcept = 0;
+    virtual void begin(SboPtr<AnyCursorBase<T>>& cursor) = 0;
+    virtual void begin(SboPtr<AnyCursorBase<T>>& cursor) const = 0;
+  };
+
+  // (if ConstOnly, non-const iterations iterate over the const view):
+  template<typename T, typename V, bool ConstOnly>
+  struct AnyViewImpl : AnyViewBase<T> {
+    V base_;
+
+    explicit AnyViewImpl(V v)
+     : base_(std::move(v)) {
+    }
+    AnyViewBase<T>* moveTo(void* buf) noexcept override {
+      return ::new (buf) AnyViewImpl(std::move(*this));
+    }
+    void begin(SboPtr<AnyCursorBase<T>>& cursor) override {
+      if constexpr (ConstOnly) {
+        std::as_const(*this).begin(cursor);
+      }
+      else {
+        cursor.template emplace<AnyCursor<T, V>>(std::ranges::begin(base_), std::ranges::end(base_));
+      }
+    }
+    void begin(SboPtr<AnyCursorBase<T>>& cursor) const override {
+      if constexpr (any_viewable<const V, T>) {
+        cursor.template emplace<AnyCursor<T, const V>>(std::ranges::begin(base_), std::ranges::end(base_));
+      }
+      else {
+        // views that are not const-iterable are iterated as a copy
+        // (copying only reads the erased view, so concurrent const iterations are fine):
+        cursor.template emplace<AnyCopyCursor<T, V>>(std::make_unique<V>(base_));
+      }
+    }
+  };
+
+} // namespace _intern
+
+} // namespace belleviews
+
+
+//*************************************************************
+// class belleviews::basic_any_view
+// belleviews::any_view<T>        (bel::any_view<T>)
+// belleviews::any_const_view<T>  (bel::any_const_view<T>)
+// 
+// A C++ view
+// erasing the type of any (belle) view with elements convertible to T
+// (to pass pipelines across library boundaries without templates)
+// - The erased view is stored inline if it is small (small-buffer optimization)
+// - Iterating copies the elements in blocks of 64 elements into a buffer in the iterator
+//   (one virtual call per block instead of several virtual calls per element)
+// with the following benefits compared to C++ standard views
+// - Iterating is stateless
+//   - Can iterate over elements when the view is const
+//   - Supports concurrent iterations
+// - Always propagates const
+// Because
+// - The iterators own the iteration state and the buffer
+// - The elements are always const
+// NOTE:
+// - The views are read-only: the elements are copies
+//   (so they are const to not silently lose modifications)
+// - any_view iterates over the non-const erased view when it is non-const
+//   (const any_views iterate over copies of erased views that are not const-iterable)
+// - any_const_view only iterates over the const erased view
+// - As with owning_view, the view can be moved but not copied
+// - The iterators are input iterators only
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<typename T, bool ConstOnly>
+requires std::is_object_v<T> && std::default_initializable<T> && std::movable<T>
+class basic_any_view : public std::ranges::view_interface<basic_any_view<T, ConstOnly>>
+{
+ public:
+  static constexpr std::size_t block_size = 64;
+
+ private:
+  _intern::SboPtr<_intern::AnyViewBase<T>> view_;
+
+  class Iterator
+  {
+   private:
+    friend basic_any_view;
+    _intern::SboPtr<_intern::AnyCursorBase<T>> cursor_;
+    std::size_t pos_ = 0;
+    std::size_t num_ = 0;
+    T block_[block_size]{};
+
+    void nextBlock() {
+      num_ = cursor_->next_block(std::span<T>{block_});
+      pos_ = 0;
+    }
+
+   public:
+    using iterator_concept = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() = default;
+    Iterator(Iterator&&) = default;
+    Iterator& operator=(Iterator&&) = default;
+
+    const T& operator*() const {
+      return block_[pos_];
+    }
+
+    Iterator& operator++() {
+      if (++pos_ == num_) {
+        nextBlock();
+      }
+      return *this;
+    }
+    void operator++(int) {
+      ++*this;
+    }
+
+    friend bool operator==(const Iterator& i, std::default_sentinel_t) {
+      return i.num_ == 0;
+    }
+  };
+
+  template<typename Self>
+  static Iterator makeBegin(Self& self) {
+    Iterator it;
+    if (self.view_) {
+      (*self.view_).begin(it.cursor_);
+      it.nextBlock();
+    }
+    return it;
+  }
+
+ public:
+  basic_any_view() = default;
+
+  template<_intern::different_from<basic_any_view> Rg>
+  requires std::ranges::viewable_range<Rg>
+           && ((ConstOnly && _intern::any_viewable<const std::views::all_t<Rg>, T>)
+               || (!ConstOnly && _intern::any_viewable<std::views::all_t<Rg>, T>
+                   && (_intern::any_viewable<const std::views::all_t<Rg>, T>
+                       || std::copy_constructible<std::views::all_t<Rg>>)))
+  basic_any_view(Rg&& rg) {
+    view_.template emplace<_intern::AnyViewImpl<T, std::views::all_t<Rg>, ConstOnly>>(std::views::all(std::forward<Rg>(rg)));
+  }
+
+  basic_any_view(basic_any_view&&) = default;
+  basic_any_view& operator=(basic_any_view&&) = default;
+
+  Iterator begin() {
+    if constexpr (ConstOnly) {
+      return makeBegin(std::as_const(*this));
+    }
+    else {
+      return makeBegin(*this);
+    }
+  }
+  Iterator begin() const {
+    return makeBegin(*this);
+  }
+
+  std::default_sentinel_t end() const noexcept {
+    return std::default_sentinel;
+  }
+};
+
+// any_view<T>:
+// - yields const T& (iterates over the non-const erased view when non-const)
+template<typename T>
+using any_view = basic_any_view<T, false>;
+
+// any_const_view<T>:
+// - always yields const T& (only needs const iterations of the erased view)
+template<typename T>
+using any_const_view = basic_any_view<T, true>;
+
+} // namespace belleviews
+
+
+BELLEVIEWS_EXPORT namespace bel {
+  // bel::any_view<T> and bel::any_const_view<T> :
+  template<typename T>
+  using any_view = belleviews::any_view<T>;
+  template<typename T>
+  using any_const_view = belleviews::any_const_view<T>;
+}
+
+#endif // BELLEANYVIEW_HPP
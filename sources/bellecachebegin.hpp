@@ -0,0 +1,297 @@
+// <bellecachebegin.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+// If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef BELLECACHEBEGIN_HPP
+#define BELLECACHEBEGIN_HPP
+
+#include <concepts>
+#include <ranges>
+#include <atomic>
+#include <optional>
+#include <utility>
+#include "bellestability.hpp"
+
+//*************************************************************
+// class belleviews::cache_begin_view
+// 
+// A C++ view
+// with the following benefits compared to C++ standard views
+// - Iterating is still stateless
+//   - Can iterate over elements when the view is const
+//   - Supports concurrent iterations
+// - Always propagates const
+// Because
+// - This view computes begin() lazily on first use (const or not)
+//   exactly once, even if multiple threads iterate concurrently
+//   (the first caller computes, concurrent callers wait for the result)
+// - This view yields const iterators when it is const
+// - Copies (and moved-to views) compute their begin() again
+// Detects whether the cached begin is no longer valid
+// (in O(1) for all containers supported by stability_traits<>)
+// - then the begin is computed again and cached
+//   (as soon as no other thread reads the cache, so that concurrent iterations are still fine)
+// - and reported to the stale begin handler
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<std::ranges::view V>
+class cache_begin_view : public std::ranges::view_interface<cache_begin_view<V>>
+{
+ private:
+   // state of the cache (the values from ready on count the threads reading the cache):
+   enum CacheState : unsigned { empty = 0, computing = 1, ready = 2 };
+
+   // mutable because begin() const computes the cache
+   // (all accesses are synchronized by state_ and the base is only modified there):
+   mutable V base_ = V();
+   mutable std::optional<std::ranges::iterator_t<V>> beg_;
+   mutable std::atomic<unsigned> state_ = empty;
+   // fingerprint of the innermost base (see stability_traits<>) the begin was computed for
+   // (written only together with beg_):
+   using Fingerprint = _intern::BeginFingerprint<V>;
+   [[no_unique_address]] mutable Fingerprint::type fingerprint_{};
+
+   std::ranges::iterator_t<V> checkedBegin() const {
+     for (;;) {
+       unsigned st = state_.load(std::memory_order_acquire);
+       if (st == computing) {
+         state_.wait(computing, std::memory_order_acquire);
+         continue;
+       }
+       if (st == empty) {
+         if (state_.compare_exchange_weak(st, computing, std::memory_order_acquire)) {
+           return computeBegin();
+         }
+         continue;
+       }
+       if constexpr (!Fingerprint::enabled) {
+         // the cache is never recomputed, so we can read it without registering:
+         return *beg_;
+       }
+       else {
+         // register as reader so that nobody recomputes the cache while we read it:
+         if (!state_.compare_exchange_weak(st, st + 1, std::memory_order_acquire)) {
+           continue;
+         }
+         // check the fingerprint before copying the cached begin
+         // (copying an invalidated iterator is an error in debug modes):
+         if (Fingerprint::of(base_) == fingerprint_) [[likely]] {
+           auto beg = *beg_;
+           state_.fetch_sub(1, std::memory_order_release);
+           return beg;
+         }
+         state_.fetch_sub(1, std::memory_order_release);
+         // stale begin: recompute it as soon as no other thread reads the cache:
+         unsigned idle = ready;
+         if (state_.compare_exchange_strong(idle, computing, std::memory_order_acquire)) {
+           _intern::reportStaleBegin("cache_begin_view: cached begin() no longer valid (recomputed)");
+           return computeBegin();
+         }
+       }
+     }
+   }
+
+   // compute and publish the cache (only called in state computing):
+   std::ranges::iterator_t<V> computeBegin() const {
+     try {
+       beg_.emplace(std::ranges::begin(base_));
+       fingerprint_ = Fingerprint::of(base_);
+     }
+     catch (...) {
+       beg_.reset();
+       state_.store(empty, std::memory_order_release);
+       state_.notify_all();
+       throw;
+     }
+     auto beg = *beg_;
+     state_.store(ready, std::memory_order_release);
+     state_.notify_all();
+     return beg;
+   }
+
+   // call op with the non-const base (for views that are not const-iterable)
+   // registered as reader, so that it never runs while the cache is computed:
+   template<typename Op>
+   decltype(auto) withBase(Op op) const {
+     for (;;) {
+       unsigned st = state_.load(std::memory_order_acquire);
+       if (st < ready) {
+         checkedBegin();   // compute the cache first
+         continue;
+       }
+       if (state_.compare_exchange_weak(st, st + 1, std::memory_order_acquire)) {
+         struct Unregister {
+           std::atomic<unsigned>& state;
+           ~Unregister() { state.fetch_sub(1, std::memory_order_release); }
+         } unregister{state_};
+         return op(base_);
+       }
+     }
+   }
+
+ public:
+  cache_begin_view() requires std::default_initializable<V> = default;
+
+  constexpr explicit cache_begin_view(V v)
+   : base_(std::move(v)) {
+  }
+
+  // copies don't share the cache (the cached begin might refer to the source):
+  cache_begin_view(const cache_begin_view& rhs) requires std::copy_constructible<V>
+   : base_(rhs.base_) {
+  }
+  cache_begin_view(cache_begin_view&& rhs)
+   : base_(std::move(rhs.base_)) {
+    rhs.reset();
+  }
+  cache_begin_view& operator=(const cache_begin_view& rhs) requires std::copyable<V> {
+    if (this != &rhs) {
+      base_ = rhs.base_;
+      reset();
+    }
+    return *this;
+  }
+  cache_begin_view& operator=(cache_begin_view&& rhs) {
+    if (this != &rhs) {
+      base_ = std::move(rhs.base_);
+      reset();
+      rhs.reset();
+    }
+    return *this;
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { reset(); return std::move(base_); }
+
+  auto begin()
+  {
+    return checkedBegin();
+  }
+  auto begin() const
+  {
+    return std::make_const_iterator(checkedBegin());
+  }
+  constexpr auto end()
+  {
+    return std::ranges::end(base_);
+  }
+  // (the base is mutable, so use its const members if there are any
+  //  and otherwise synchronize with computing begin()):
+  constexpr auto end() const
+  {
+    if constexpr (std::ranges::range<const V>) {
+      return std::make_const_sentinel(std::ranges::end(std::as_const(base_)));
+    }
+    else {
+      return std::make_const_sentinel(withBase([] (V& base) { return std::ranges::end(base); }));
+    }
+  }
+
+  constexpr auto size() requires std::ranges::sized_range<V>
+  {
+    return std::ranges::size(base_);
+  }
+  constexpr auto size() const requires std::ranges::sized_range<V>
+  {
+    if constexpr (std::ranges::sized_range<const V>) {
+      return std::ranges::size(std::as_const(base_));
+    }
+    else {
+      return withBase([] (V& base) { return std::ranges::size(base); });
+    }
+  }
+
+ private:
+  // not thread-safe (only called while nobody iterates):
+  void reset() {
+    beg_.reset();
+    state_.store(empty, std::memory_order_relaxed);
+  }
+};
+
+template<typename R>
+cache_begin_view(R&&) -> cache_begin_view<std::views::all_t<R>>;
+
+} // namespace belleviews
+
+// borrowed if the underlying range is borrowed (copies compute their own begin()):
+template<typename Rg>
+inline constexpr bool std::ranges::enable_borrowed_range<belleviews::cache_begin_view<Rg>>
+  = std::ranges::enable_borrowed_range<Rg>;
+
+
+//*************************************************************
+// belleviews::cache_begin()
+// bel::views::cache_begin()
+// 
+// A C++ cache_begin_view adaptor for the belleviews::cache_begin_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename Rg>
+  concept can_cache_begin_view = requires { cache_begin_view(std::declval<Rg>()); };
+}
+
+struct CacheBegin {
+   // for:  bel::views::cache_begin(rg)
+   template<std::ranges::viewable_range Rg>
+   requires _intern::can_cache_begin_view<Rg>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg) const {
+     return cache_begin_view{std::forward<Rg>(rg)};
+   }
+
+   // for:  rg | bel::views::cache_begin()
+   struct PartialCacheBegin {
+   };
+
+   constexpr auto
+   operator() [[nodiscard]] () const {
+     return PartialCacheBegin{};
+   }
+
+   template<typename Rg>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialCacheBegin) {
+     return cache_begin_view{std::forward<Rg>(rg)};
+   }
+};
+
+// belleviews::cache_begin :
+inline constexpr CacheBegin cache_begin;
+
+} // namespace belleviews
+
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::cache_begin :
+  inline constexpr belleviews::CacheBegin cache_begin;
+}
+
+#endif // BELLECACHEBEGIN_HPP
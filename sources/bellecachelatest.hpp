@@ -0,0 +1,282 @@
+// <bellecachelatest.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+// If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef BELLECACHELATEST_HPP
+#define BELLECACHELATEST_HPP
+
+#include <concepts>
+#include <ranges>
+#include <optional>
+#include <memory>
+
+//*************************************************************
+// class belleviews::cache_latest_view
+// 
+// A C++ view
+// caching the latest dereferenced element
+// (e.g., to compute a transformed element only once in transform | filter)
+// with the following benefits compared to C++ standard views (C++26 cache_latest)
+// - Iterating is stateless
+//   - Can iterate over elements when the view is const
+//   - Supports concurrent iterations
+// - Always propagates const
+// Because
+// - This view caches in the iterator instead of in the view
+//   (each iteration has its own cache)
+// - This view yields const iterators when it is const
+// NOTE:
+// - As with std::views::cache_latest, the iterators are input iterators only
+//   (a reference to the cache is only valid as long as the iterator is not modified)
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<std::ranges::input_range V>
+requires std::ranges::view<V>
+class cache_latest_view : public std::ranges::view_interface<cache_latest_view<V>>
+{
+ private:
+  template<bool ConstT>
+    using Base = _intern::maybe_const_t<ConstT, V>;
+
+  template<bool ConstT>
+  struct Sentinel;
+
+  template<bool ConstT>
+  struct Iterator
+  {
+   private:
+    using VIterT = std::ranges::iterator_t<Base<ConstT>>;
+    using RefT = std::ranges::range_reference_t<Base<ConstT>>;
+    // cache a pointer for references, the (assignable) value otherwise:
+    using CacheT = std::conditional_t<std::is_reference_v<RefT>,
+                                      std::add_pointer_t<RefT>,
+                                      std::remove_cv_t<RefT>>;
+
+    VIterT current_ = VIterT();                           // current position
+    mutable std::optional<CacheT> cache_;                 // element at current position
+
+   public:
+    using iterator_concept = std::input_iterator_tag;
+    using value_type = std::ranges::range_value_t<Base<ConstT>>;
+    using difference_type = std::ranges::range_difference_t<Base<ConstT>>;
+
+    Iterator() requires std::default_initializable<VIterT> = default;
+    constexpr explicit Iterator(VIterT cur)
+     : current_(std::move(cur)) {
+    }
+    constexpr Iterator(Iterator<!ConstT> i)
+      requires ConstT && std::convertible_to<std::ranges::iterator_t<V>, VIterT>
+     : current_(std::move(i.current_)) {
+    }
+
+    constexpr const VIterT& base() const& noexcept {
+      return current_;
+    }
+    constexpr VIterT base() && {
+      return std::move(current_);
+    }
+
+    // yields an lvalue (as std::views::cache_latest), so that dereferencing twice
+    // doesn't move the cached value away:
+    constexpr RefT& operator*() const {
+      if constexpr (std::is_reference_v<RefT>) {
+        if (!cache_) {
+          cache_ = std::addressof(static_cast<RefT&>(*current_));
+        }
+        return static_cast<RefT&>(**cache_);
+      }
+      else {
+        if (!cache_) {
+          cache_.emplace(*current_);
+        }
+        return *cache_;
+      }
+    }
+
+    constexpr Iterator& operator++() {
+      cache_.reset();
+      ++current_;
+      return *this;
+    }
+    constexpr void operator++(int) {
+      ++*this;
+    }
+
+    friend constexpr std::ranges::range_rvalue_reference_t<Base<ConstT>> iter_move(const Iterator& i)
+      noexcept(noexcept(std::ranges::iter_move(i.current_))) {
+        return std::ranges::iter_move(i.current_);
+    }
+    friend constexpr void iter_swap(const Iterator& x, const Iterator& y)
+      noexcept(noexcept(std::ranges::iter_swap(x.current_, y.current_)))
+      requires std::indirectly_swappable<VIterT> {
+        std::ranges::iter_swap(x.current_, y.current_);
+    }
+
+    friend Iterator<!ConstT>;
+    template<bool> friend struct Sentinel;
+  };
+
+  template<bool ConstT>
+  struct Sentinel
+  {
+   private:
+    using VSentT = std::ranges::sentinel_t<Base<ConstT>>;
+    VSentT end_ = VSentT();
+
+    // as members to have access to the iterator:
+    constexpr bool equal(const Iterator<ConstT>& i) const {
+      return i.current_ == end_;
+    }
+    constexpr auto distanceFrom(const Iterator<ConstT>& i) const {
+      return end_ - i.current_;
+    }
+
+   public:
+    Sentinel() = default;
+    constexpr explicit Sentinel(VSentT end)
+     : end_(std::move(end)) {
+    }
+    constexpr Sentinel(Sentinel<!ConstT> s)
+      requires ConstT && std::convertible_to<std::ranges::sentinel_t<V>, VSentT>
+     : end_(std::move(s.end_)) {
+    }
+
+    constexpr VSentT base() const {
+      return end_;
+    }
+
+    friend constexpr bool operator==(const Iterator<ConstT>& i, const Sentinel& s) {
+      return s.equal(i);
+    }
+    friend constexpr auto operator-(const Iterator<ConstT>& i, const Sentinel& s)
+      requires std::sized_sentinel_for<VSentT, std::ranges::iterator_t<Base<ConstT>>> {
+      return -s.distanceFrom(i);
+    }
+    friend constexpr auto operator-(const Sentinel& s, const Iterator<ConstT>& i)
+      requires std::sized_sentinel_for<VSentT, std::ranges::iterator_t<Base<ConstT>>> {
+      return s.distanceFrom(i);
+    }
+
+    friend Sentinel<!ConstT>;
+  };
+
+  V base_ = V();
+
+ public:
+  cache_latest_view() requires std::default_initializable<V> = default;
+
+  constexpr explicit cache_latest_view(V v)
+   : base_(std::move(v)) {
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { return std::move(base_); }
+
+  constexpr auto begin() {
+    return Iterator<false>{std::ranges::begin(base_)};
+  }
+  constexpr auto begin() const requires std::ranges::input_range<const V> {
+    return std::make_const_iterator(Iterator<true>{std::ranges::begin(base_)});
+  }
+
+  constexpr auto end() {
+    return Sentinel<false>{std::ranges::end(base_)};
+  }
+  constexpr auto end() const requires std::ranges::input_range<const V> {
+    return std::make_const_sentinel(Sentinel<true>{std::ranges::end(base_)});
+  }
+
+  constexpr auto size() requires std::ranges::sized_range<V> {
+    return std::ranges::size(base_);
+  }
+  constexpr auto size() const requires std::ranges::sized_range<const V> {
+    return std::ranges::size(base_);
+  }
+};
+
+template<typename R>
+cache_latest_view(R&&) -> cache_latest_view<std::views::all_t<R>>;
+
+} // namespace belleviews
+
+// iterators don't refer to the view:
+template<typename V>
+inline constexpr bool std::ranges::enable_borrowed_range<belleviews::cache_latest_view<V>>
+  = std::ranges::enable_borrowed_range<V>;
+
+
+//*************************************************************
+// belleviews::cache_latest()
+// bel::views::cache_latest()
+// 
+// A C++ cache_latest_view adaptor for the belleviews::cache_latest_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename Rg>
+  concept can_cache_latest_view = requires { cache_latest_view(std::declval<Rg>()); };
+}
+
+struct CacheLatest {
+   // for:  bel::views::cache_latest(rg)
+   template<std::ranges::viewable_range Rg>
+   requires _intern::can_cache_latest_view<Rg>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg) const {
+     return cache_latest_view{std::forward<Rg>(rg)};
+   }
+
+   // for:  rg | bel::views::cache_latest()
+   struct PartialCacheLatest {
+   };
+
+   constexpr auto
+   operator() [[nodiscard]] () const {
+     return PartialCacheLatest{};
+   }
+
+   template<typename Rg>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialCacheLatest) {
+     return cache_latest_view{std::forward<Rg>(rg)};
+   }
+};
+
+// belleviews::cache_latest :
+inline constexpr CacheLatest cache_latest;
+
+} // namespace belleviews
+
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::cache_latest :
+  inline constexpr belleviews::CacheLatest cache_latest;
+}
+
+#endif // BELLECACHELATEST_HPP
@@ -0,0 +1,375 @@
+// <bellechunk.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLECHUNK_HPP
+#define BELLECHUNK_HPP
+
+#include <concepts>
+#include <ranges>
+#include <iterator>
+#include <span>
+#include <cassert>
+#include "bellesub.hpp"
+#include "belletake.hpp"
+
+//*************************************************************
+// class belleviews::chunk_view
+//
+// A C++ view yielding the elements in chunks of n elements
+// (the last chunk might be smaller)
+// with the following benefits compared to C++ standard views
+// - Iterating is stateless
+// - Can iterate over const views
+// - Concurrent iterations are safe
+// - Always propagates const
+// - Chunks of contiguous ranges are std::span<>s
+//   (so that kernels processing the chunks operate on raw memory)
+// Because
+// - This view does not cache anything
+// - This view yields chunks of const elements when it is const
+// - The chunk type depends on the underlying range:
+//   - contiguous ranges:           std::span<> (of const elements if const)
+//   - other random-access ranges:  sub_view<> of two iterators
+//   - other forward ranges:        take_view<> of a sub_view<>
+// - size() is O(1) if the underlying range is sized
+// OPEN/TODO:
+// - input ranges are not supported yet
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<std::ranges::view V>
+requires std::ranges::forward_range<V>
+class chunk_view : public std::ranges::view_interface<chunk_view<V>>
+{
+ private:
+  // one iterator type for both the non-const and the const view
+  // (the const one iterates with const iterators of the underlying const view):
+  template<bool ConstT>
+  using VIter = typename _intern::MaybeConstIterators<ConstT, V>::iterator;
+  template<bool ConstT>
+  using VSent = typename _intern::MaybeConstIterators<ConstT, V>::sentinel;
+
+  template<bool ConstT>
+  class Iterator
+  {
+   private:
+    using VIterT = VIter<ConstT>;
+    using VSentT = VSent<ConstT>;
+
+    static constexpr bool isContiguous = std::contiguous_iterator<VIterT>
+                                          && std::sized_sentinel_for<VSentT, VIterT>;
+    static constexpr bool isRandomAccess = std::random_access_iterator<VIterT>
+                                            && std::sized_sentinel_for<VSentT, VIterT>;
+
+    static auto _s_chunk_type() {
+      if constexpr (isContiguous)
+        return std::span<std::remove_reference_t<std::iter_reference_t<VIterT>>>{};
+      else if constexpr (isRandomAccess)
+        return sub_view<VIterT, VIterT>{};
+      else
+        return take_view<sub_view<VIterT, VSentT>>{};
+    }
+    static constexpr auto _s_iter_concept() {
+      if constexpr (std::ranges::random_access_range<V>)
+        return std::random_access_iterator_tag{};
+      else if constexpr (std::ranges::bidirectional_range<V>)
+        return std::bidirectional_iterator_tag{};
+      else
+        return std::forward_iterator_tag{};
+    }
+
+   public:
+    using iterator_category = std::input_iterator_tag;   // operator* yields prvalues
+    using iterator_concept = decltype(_s_iter_concept());
+    using value_type = decltype(_s_chunk_type());
+    using difference_type = std::ranges::range_difference_t<V>;
+
+   private:
+    friend chunk_view;
+    VIterT current_ = VIterT();
+    VSentT end_ = VSentT();
+    difference_type n_ = 0;
+    difference_type missing_ = 0;   // elements missing in the last chunk after end is reached
+
+    constexpr Iterator(VIterT cur, VSentT end, difference_type n, difference_type missing = 0)
+     : current_{std::move(cur)}, end_{std::move(end)}, n_{n}, missing_{missing} {
+    }
+
+   public:
+    Iterator() = default;
+
+    constexpr Iterator(Iterator<!ConstT> i)
+      requires ConstT && std::convertible_to<VIter<false>, VIterT>
+                      && std::convertible_to<VSent<false>, VSentT>
+     : current_{std::move(i.current_)}, end_{std::move(i.end_)}, n_{i.n_}, missing_{i.missing_} {
+    }
+
+    constexpr VIterT base() const {
+      return current_;
+    }
+
+    constexpr value_type operator*() const {
+      assert(current_ != end_);
+      if constexpr (isContiguous) {
+        return value_type{std::to_address(current_),
+                          static_cast<std::size_t>(std::ranges::min(n_, difference_type(end_ - current_)))};
+      }
+      else if constexpr (isRandomAccess) {
+        return value_type{current_, std::ranges::next(current_, n_, end_)};
+      }
+      else {
+        return value_type{sub_view<VIterT, VSentT>{current_, end_}, n_};
+      }
+    }
+
+    constexpr Iterator& operator++() {
+      missing_ = std::ranges::advance(current_, n_, end_);
+      return *this;
+    }
+    constexpr Iterator operator++(int) {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    constexpr Iterator& operator--() requires std::ranges::bidirectional_range<V> {
+      std::ranges::advance(current_, missing_ - n_);
+      missing_ = 0;
+      return *this;
+    }
+    constexpr Iterator operator--(int) requires std::ranges::bidirectional_range<V> {
+      auto tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    constexpr Iterator& operator+=(difference_type x) requires std::ranges::random_access_range<V> {
+      if (x > 0) {
+        missing_ = std::ranges::advance(current_, n_ * x, end_);
+      }
+      else if (x < 0) {
+        std::ranges::advance(current_, n_ * x + missing_);
+        missing_ = 0;
+      }
+      return *this;
+    }
+    constexpr Iterator& operator-=(difference_type x) requires std::ranges::random_access_range<V> {
+      return *this += -x;
+    }
+    constexpr value_type operator[](difference_type n) const requires std::ranges::random_access_range<V> {
+      return *(*this + n);
+    }
+
+    friend constexpr bool operator==(const Iterator& x, const Iterator& y) {
+      return x.current_ == y.current_;
+    }
+    friend constexpr bool operator==(const Iterator& x, std::default_sentinel_t) {
+      return x.current_ == x.end_;
+    }
+    friend constexpr auto operator<=>(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> && std::three_way_comparable<VIterT> {
+      return x.current_ <=> y.current_;
+    }
+    friend constexpr bool operator<(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return x.current_ < y.current_;
+    }
+    friend constexpr bool operator>(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return y < x;
+    }
+    friend constexpr bool operator<=(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return !(y < x);
+    }
+    friend constexpr bool operator>=(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return !(x < y);
+    }
+
+    friend constexpr Iterator operator+(const Iterator& i, difference_type n)
+      requires std::ranges::random_access_range<V> {
+      auto r = i;
+      r += n;
+      return r;
+    }
+    friend constexpr Iterator operator+(difference_type n, const Iterator& i)
+      requires std::ranges::random_access_range<V> {
+      return i + n;
+    }
+    friend constexpr Iterator operator-(const Iterator& i, difference_type n)
+      requires std::ranges::random_access_range<V> {
+      auto r = i;
+      r -= n;
+      return r;
+    }
+    friend constexpr difference_type operator-(const Iterator& x, const Iterator& y)
+      requires std::sized_sentinel_for<VIterT, VIterT> {
+      return (x.current_ - y.current_ + x.missing_ - y.missing_) / x.n_;
+    }
+    friend constexpr difference_type operator-(std::default_sentinel_t, const Iterator& i)
+      requires std::sized_sentinel_for<VSentT, VIterT> {
+      return _intern::divCeil(difference_type(i.end_ - i.current_), i.n_);
+    }
+    friend constexpr difference_type operator-(const Iterator& i, std::default_sentinel_t s)
+      requires std::sized_sentinel_for<VSentT, VIterT> {
+      return -(s - i);
+    }
+  };
+
+ private:
+  V base_ = V();
+  std::ranges::range_difference_t<V> n_ = 1;
+
+  template<bool ConstT, typename Self>
+  static constexpr auto beginImpl(Self& self) {
+    if constexpr (ConstT) {
+      return Iterator<true>{std::make_const_iterator(std::ranges::begin(self.base_)),
+                            std::make_const_sentinel(std::ranges::end(self.base_)),
+                            self.n_};
+    }
+    else {
+      return Iterator<false>{std::ranges::begin(self.base_), std::ranges::end(self.base_), self.n_};
+    }
+  }
+  template<bool ConstT, typename Self>
+  static constexpr auto endImpl(Self& self) {
+    using Base = _intern::maybe_const_t<ConstT, V>;
+    if constexpr (std::ranges::common_range<Base> && std::ranges::sized_range<Base>) {
+      auto missing = (self.n_ - std::ranges::distance(self.base_) % self.n_) % self.n_;
+      auto pos = beginImpl<ConstT>(self);
+      pos.current_ = pos.end_;
+      pos.missing_ = missing;
+      return pos;
+    }
+    else if constexpr (std::ranges::common_range<Base> && !std::ranges::bidirectional_range<Base>) {
+      auto pos = beginImpl<ConstT>(self);
+      pos.current_ = pos.end_;
+      return pos;
+    }
+    else {
+      return std::default_sentinel;
+    }
+  }
+
+ public:
+  chunk_view() requires std::default_initializable<V> = default;
+
+  constexpr chunk_view(V base, std::ranges::range_difference_t<V> n)
+   : base_(std::move(base)), n_{n} {
+      assert(n > 0);
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { return std::move(base_); }
+
+  constexpr auto begin() {
+    return beginImpl<false>(*this);
+  }
+  constexpr auto begin() const requires std::ranges::forward_range<const V> {
+    return beginImpl<true>(*this);
+  }
+
+  constexpr auto end() {
+    return endImpl<false>(*this);
+  }
+  constexpr auto end() const requires std::ranges::forward_range<const V> {
+    return endImpl<true>(*this);
+  }
+
+  // number of chunks in O(1):
+  constexpr auto size() requires std::ranges::sized_range<V> {
+    using SizeT = decltype(std::ranges::size(base_));
+    return _intern::divCeil(std::ranges::size(base_), static_cast<SizeT>(n_));
+  }
+  constexpr auto size() const requires std::ranges::sized_range<const V> {
+    using SizeT = decltype(std::ranges::size(base_));
+    return _intern::divCeil(std::ranges::size(base_), static_cast<SizeT>(n_));
+  }
+};
+
+template<typename R>
+chunk_view(R&&, std::ranges::range_difference_t<R>) -> chunk_view<std::views::all_t<R>>;
+
+} // namespace belleviews
+
+// borrowed if underlying range is borrowed (as with std chunk_view):
+template<typename V>
+inline constexpr bool std::ranges::enable_borrowed_range<belleviews::chunk_view<V>> = std::ranges::enable_borrowed_range<V>;
+
+
+//*************************************************************
+// belleviews::chunk()
+// bel::views::chunk()
+//
+// A C++ chunk_view adaptor for the belleviews::chunk_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename Rg, typename DiffT>
+  concept can_chunk_view = requires { chunk_view(std::declval<Rg>(), std::declval<DiffT>()); };
+}
+
+struct Chunk {
+   // for:  bel::views::chunk(rg, 4096)
+   template<std::ranges::viewable_range Rg, typename DiffT = std::ranges::range_difference_t<Rg>>
+   requires _intern::can_chunk_view<Rg, DiffT>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg, DiffT n) const {
+     return chunk_view{std::forward<Rg>(rg), n};
+   }
+
+   // for:  rg | bel::views::chunk(4096)
+   template<typename T>
+   struct PartialChunk {
+     T n;
+   };
+
+   template<typename DiffT>
+   constexpr auto
+   operator() [[nodiscard]] (DiffT n) const {
+     return PartialChunk<DiffT>{n};
+   }
+
+   template<typename Rg, typename DiffT>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialChunk<DiffT> pc) {
+     return chunk_view{std::forward<Rg>(rg), pc.n};
+   }
+};
+
+// belleviews::chunk() :
+inline constexpr Chunk chunk;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::chunk() :
+  inline constexpr belleviews::Chunk chunk;
+}
+
+#endif // BELLECHUNK_HPP
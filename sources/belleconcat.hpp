@@ -0,0 +1,352 @@
+// <belleconcat.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLECONCAT_HPP
+#define BELLECONCAT_HPP
+
+#include <concepts>
+#include <ranges>
+#include <iterator>
+#include <tuple>
+#include <variant>
+#include <utility>
+#include <type_traits>
+#include "bellesub.hpp"
+
+//*************************************************************
+// class belleviews::concat_view
+//
+// A C++ view iterating over multiple ranges one after the other
+// (e.g. over an in-memory tail and a persisted head as one sequence)
+// with the following benefits compared to C++ standard views
+// - Iterating is stateless
+// - Can iterate over const views
+// - Concurrent iterations are safe
+// - Always propagates const
+// Because
+// - This view does not cache anything
+// - This view yields const iterators of all ranges when it is const
+// Also:
+// - size() is O(1) if all ranges are sized
+// - for_each_segment(op) calls op for each range
+//   so that algorithms (see bellesegmented.hpp) use the fast path of each range
+//   (e.g. memmove() for contiguous ranges) instead of dispatching with each element
+// OPEN/TODO:
+// - random access
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  // call op with std::integral_constant<std::size_t, idx> for a runtime index idx < N:
+  template<std::size_t N, typename Op>
+  constexpr void withIndex(std::size_t idx, Op&& op) {
+    [&]<std::size_t... Idx>(std::index_sequence<Idx...>) {
+      ((idx == Idx ? (op(std::integral_constant<std::size_t, Idx>{}), true) : false) || ...);
+    }(std::make_index_sequence<N>{});
+  }
+
+  template<typename... Rgs>
+  concept concatable = requires {
+    typename std::common_reference_t<std::ranges::range_reference_t<Rgs>...>;
+    typename std::common_type_t<std::ranges::range_value_t<Rgs>...>;
+  };
+}
+
+template<std::ranges::input_range... Vs>
+requires (sizeof...(Vs) > 0) && (std::ranges::view<Vs> && ...) && _intern::concatable<Vs...>
+class concat_view : public std::ranges::view_interface<concat_view<Vs...>>
+{
+ private:
+  static constexpr std::size_t numRanges = sizeof...(Vs);
+
+  // one iterator type for both the non-const and the const view
+  // (the const one iterates with const iterators of the underlying const views):
+  template<bool ConstT, typename V>
+  using VIter = typename _intern::MaybeConstIterators<ConstT, V>::iterator;
+  template<bool ConstT, std::size_t I>
+  using VIterAt = VIter<ConstT, std::tuple_element_t<I, std::tuple<Vs...>>>;
+
+  template<bool ConstT, std::size_t I, typename Self>
+  static constexpr auto baseBegin(Self& self) {
+    if constexpr (ConstT) {
+      return std::make_const_iterator(std::ranges::begin(std::get<I>(self.bases_)));
+    }
+    else {
+      return std::ranges::begin(std::get<I>(self.bases_));
+    }
+  }
+  template<bool ConstT, std::size_t I, typename Self>
+  static constexpr auto baseEnd(Self& self) {
+    if constexpr (ConstT) {
+      return std::make_const_sentinel(std::ranges::end(std::get<I>(self.bases_)));
+    }
+    else {
+      return std::ranges::end(std::get<I>(self.bases_));
+    }
+  }
+
+  static constexpr bool allForward = (std::ranges::forward_range<Vs> && ...);
+  static constexpr bool isBidirectional = (std::ranges::bidirectional_range<Vs> && ...)
+                                          && (std::ranges::common_range<Vs> && ...);
+
+  template<bool ConstT>
+  class Iterator
+  {
+   private:
+    using Parent = _intern::maybe_const_t<ConstT, concat_view>;
+
+    static constexpr auto _s_iter_concept() {
+      if constexpr (isBidirectional)
+        return std::bidirectional_iterator_tag{};
+      else if constexpr (allForward)
+        return std::forward_iterator_tag{};
+      else
+        return std::input_iterator_tag{};
+    }
+
+   public:
+    using iterator_concept = decltype(_s_iter_concept());
+    using reference = std::common_reference_t<std::iter_reference_t<VIter<ConstT, Vs>>...>;
+    using value_type = std::common_type_t<std::ranges::range_value_t<Vs>...>;
+    using difference_type = std::common_type_t<std::ranges::range_difference_t<Vs>...>;
+    // (only iterators yielding references are legacy forward iterators):
+    using iterator_category = std::conditional_t<std::is_reference_v<reference>,
+                                                 iterator_concept, std::input_iterator_tag>;
+
+   private:
+    friend concat_view;
+    friend Iterator<!ConstT>;
+    Parent* parent_ = nullptr;
+    std::variant<VIter<ConstT, Vs>...> it_;
+
+    template<std::size_t I, typename It>
+    constexpr Iterator(Parent* parent, std::in_place_index_t<I> idx, It it)
+     : parent_{parent}, it_{idx, std::move(it)} {
+      satisfy<I>();
+    }
+
+    // skip empty ranges:
+    template<std::size_t I>
+    constexpr void satisfy() {
+      if constexpr (I + 1 < numRanges) {
+        if (std::get<I>(it_) == baseEnd<ConstT, I>(*parent_)) {
+          it_.template emplace<I + 1>(baseBegin<ConstT, I + 1>(*parent_));
+          satisfy<I + 1>();
+        }
+      }
+    }
+    template<std::size_t I>
+    constexpr void prev() {
+      if constexpr (I == 0) {
+        --std::get<0>(it_);
+      }
+      else {
+        if (std::get<I>(it_) == baseBegin<ConstT, I>(*parent_)) {
+          it_.template emplace<I - 1>(baseEnd<ConstT, I - 1>(*parent_));
+          prev<I - 1>();
+        }
+        else {
+          --std::get<I>(it_);
+        }
+      }
+    }
+
+   public:
+    Iterator() = default;
+
+    constexpr Iterator(Iterator<!ConstT> i)
+      requires ConstT && (std::convertible_to<VIter<false, Vs>, VIter<true, Vs>> && ...)
+     : parent_{i.parent_} {
+      _intern::withIndex<numRanges>(i.it_.index(), [&] (auto idx) {
+                                      it_.template emplace<idx>(std::get<idx>(std::move(i.it_)));
+                                    });
+    }
+
+    // index of the range the iterator currently iterates over:
+    constexpr std::size_t index() const noexcept {
+      return it_.index();
+    }
+
+    constexpr reference operator*() const {
+      return std::visit([] (const auto& it) -> reference { return *it; }, it_);
+    }
+
+    constexpr Iterator& operator++() {
+      _intern::withIndex<numRanges>(it_.index(), [this] (auto idx) {
+                                      ++std::get<idx>(it_);
+                                      satisfy<idx>();
+                                    });
+      return *this;
+    }
+    constexpr void operator++(int) {
+      ++*this;
+    }
+    constexpr Iterator operator++(int) requires allForward {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    constexpr Iterator& operator--() requires isBidirectional {
+      _intern::withIndex<numRanges>(it_.index(), [this] (auto idx) {
+                                      prev<idx>();
+                                    });
+      return *this;
+    }
+    constexpr Iterator operator--(int) requires isBidirectional {
+      auto tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    friend constexpr bool operator==(const Iterator& x, const Iterator& y)
+      requires (std::equality_comparable<VIter<ConstT, Vs>> && ...) {
+      return x.it_ == y.it_;
+    }
+    friend constexpr bool operator==(const Iterator& x, std::default_sentinel_t) {
+      constexpr std::size_t last = numRanges - 1;
+      return x.it_.index() == last && std::get<last>(x.it_) == baseEnd<ConstT, last>(*x.parent_);
+    }
+
+    friend constexpr auto iter_move(const Iterator& i) {
+      using RRef = std::common_reference_t<std::iter_rvalue_reference_t<VIter<ConstT, Vs>>...>;
+      return std::visit([] (const auto& it) -> RRef { return std::ranges::iter_move(it); }, i.it_);
+    }
+  };
+
+ private:
+  std::tuple<Vs...> bases_;
+
+  template<bool ConstT, typename Self>
+  static constexpr auto beginImpl(Self& self) {
+    return Iterator<ConstT>{&self, std::in_place_index<0>, baseBegin<ConstT, 0>(self)};
+  }
+  template<bool ConstT, typename Self>
+  static constexpr auto endImpl(Self& self) {
+    constexpr std::size_t last = numRanges - 1;
+    using LastV = std::tuple_element_t<last, std::tuple<Vs...>>;
+    if constexpr (std::ranges::common_range<_intern::maybe_const_t<ConstT, LastV>>) {
+      return Iterator<ConstT>{&self, std::in_place_index<last>, baseEnd<ConstT, last>(self)};
+    }
+    else {
+      return std::default_sentinel;
+    }
+  }
+
+  template<typename Self>
+  static constexpr auto sizeImpl(Self& self) {
+    return std::apply([](auto&... bases) {
+                        using SizeT = _intern::make_unsigned_like_t<std::common_type_t<decltype(std::ranges::size(bases))...>>;
+                        return (static_cast<SizeT>(std::ranges::size(bases)) + ...);
+                      }, self.bases_);
+  }
+
+ public:
+  concat_view() = default;
+
+  constexpr explicit concat_view(Vs... bases)
+   : bases_{std::move(bases)...} {
+  }
+
+  constexpr auto begin() {
+    return beginImpl<false>(*this);
+  }
+  constexpr auto begin() const requires (std::ranges::input_range<const Vs> && ...)
+                                        && _intern::concatable<const Vs...> {
+    return beginImpl<true>(*this);
+  }
+
+  constexpr auto end() {
+    return endImpl<false>(*this);
+  }
+  constexpr auto end() const requires (std::ranges::input_range<const Vs> && ...)
+                                      && _intern::concatable<const Vs...> {
+    return endImpl<true>(*this);
+  }
+
+  constexpr auto size() requires (std::ranges::sized_range<Vs> && ...) {
+    return sizeImpl(*this);
+  }
+  constexpr auto size() const requires (std::ranges::sized_range<const Vs> && ...) {
+    return sizeImpl(*this);
+  }
+
+  // the segmented structure:
+  // - calls op for each range (as sub_view of const iterators if the view is const)
+  template<typename Op>
+  constexpr void for_each_segment(Op&& op) {
+    std::apply([&op](auto&... bases) {
+                 (op(bases), ...);
+               }, bases_);
+  }
+  template<typename Op>
+  constexpr void for_each_segment(Op&& op) const requires (std::ranges::input_range<const Vs> && ...) {
+    [&]<std::size_t... Idx>(std::index_sequence<Idx...>) {
+      (op(sub_view{baseBegin<true, Idx>(*this), baseEnd<true, Idx>(*this)}), ...);
+    }(std::index_sequence_for<Vs...>{});
+  }
+};
+
+template<typename... Rgs>
+concat_view(Rgs&&...) -> concat_view<std::views::all_t<Rgs>...>;
+
+} // namespace belleviews
+
+
+//*************************************************************
+// belleviews::concat()
+// bel::views::concat()
+//
+// A C++ concat_view adaptor for the belleviews::concat_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename... Rgs>
+  concept can_concat_view = requires { concat_view<std::views::all_t<Rgs>...>(std::declval<Rgs>()...); };
+}
+
+struct Concat {
+   // for:  bel::views::concat(rg1, rg2, ...)
+   template<std::ranges::viewable_range... Rgs>
+   requires (sizeof...(Rgs) > 0) && _intern::can_concat_view<Rgs...>
+   constexpr auto
+   operator() [[nodiscard]] (Rgs&&... rgs) const {
+     // (no CTAD, which would copy a single concat_view instead of wrapping it):
+     return concat_view<std::views::all_t<Rgs>...>{std::forward<Rgs>(rgs)...};
+   }
+};
+
+// belleviews::concat() :
+inline constexpr Concat concat;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::concat() :
+  inline constexpr belleviews::Concat concat;
+}
+
+#endif // BELLECONCAT_HPP
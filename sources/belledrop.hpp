@@ -43,7 +43,7 @@
 // OPEN/TODO:
 // - ...
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 template<std::ranges::view V>
 class drop_view : public std::ranges::view_interface<drop_view<V>>
@@ -60,6 +60,7 @@ class drop_view : public std::ranges::view_interface<drop_view<V>>
   }
 
   constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
   constexpr V base() && { return std::move(base_); }
 
   constexpr auto begin()
@@ -113,7 +114,7 @@ inline constexpr bool std::ranges::enable_borrowed_range<belleviews::drop_view<R
 // 
 // A C++ drop_view adaptor for the belleviews::drop_view
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 namespace _intern {
   template<typename Rg, typename DiffT>
@@ -154,7 +155,7 @@ inline constexpr Drop drop;
 }// namespace belleviews
 
 
-namespace bel::views {
+BELLEVIEWS_EXPORT namespace bel::views {
   // bel::views::drop() :
   inline constexpr belleviews::Drop drop;
 }
@@ -46,7 +46,7 @@
 // - This view does never cache begin()
 // - This view yields const iterators when it is const
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 template<std::ranges::view V, typename Pred>
 requires std::ranges::input_range<V> && std::is_object_v<Pred>
@@ -68,6 +68,7 @@ class drop_while_view : public std::ranges::view_interface<drop_while_view<V, Pr
       { }
 
       constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+      constexpr const V& base_ref() const& noexcept { return base_; }
       constexpr V base() && { return std::move(base_); }
 
       constexpr const Pred& pred() const { return *pred_; }
@@ -109,7 +110,7 @@ inline constexpr bool std::ranges::enable_borrowed_range<belleviews::drop_while_
 // 
 // A C++ drop_view adaptor for the belleviews::drop_view
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 namespace _intern {
   template<typename Rg, typename Pred>
@@ -150,7 +151,7 @@ inline constexpr DropWhile drop_while;
 } // namespace belleviews
 
 
-namespace bel::views {
+BELLEVIEWS_EXPORT namespace bel::views {
   // bel::views::drop_while() :
   inline constexpr belleviews::DropWhile drop_while;
 }
@@ -31,6 +31,8 @@
 #include <concepts>
 #include <ranges>
 #include <cassert>
+#include "bellestability.hpp"
+#include "belleversioned.hpp"
 
 //*************************************************************
 // class belleviews::eager_begin_view
@@ -40,23 +42,15 @@
 // - Always propagates const
 // Because
 // - This view yields const iterators when it is const
+// Detects whether the begin computed eagerly is no longer valid
+// (in O(1) and for both begin() and begin() const)
+// for all containers supported by stability_traits<>
+// (e.g., by the generation counter of bel::versioned<> or by data() and size() of vectors)
+// A stale begin is recomputed and reported to the stale begin handler.
 // OPEN/TODO:
 // - ...
 //*************************************************************
-namespace belleviews {
-
-template<typename T>
-struct IsVectorTrait {
-  constexpr static bool value = false; 
-};
-
-template<typename T>
-struct IsVectorTrait<std::vector<T>>  {
-  constexpr static bool value = true; 
-};
-
-template<typename T>
-concept IsVector = IsVectorTrait<std::remove_cvref_t<T>>::value;
+BELLEVIEWS_EXPORT namespace belleviews {
 
 template<typename T>
 concept HasBase = requires(T c){c.base();};
@@ -77,68 +71,79 @@ template<std::ranges::view V>
 class eager_begin_view : public std::ranges::view_interface<eager_begin_view<V>>
 {
  private:
-   static auto&& innerBase(auto&& v) {
-     if constexpr (requires{v.base();}) {
-       return innerBase(v.base());
+   // to detect a broken begin we need the fingerprint of the innermost base
+   // (see stability_traits<>) the begin was computed for:
+   using Fingerprint = _intern::BeginFingerprint<V>;
+
+   // begin() const is cached separately because const views might yield other iterators
+   // (nothing is cached for views that are not const-iterable):
+   struct NoConstBegin {
+   };
+   using ConstIterator = std::conditional_t<std::ranges::range<const V>,
+                                            typename _intern::MaybeConstIterators<true, V>::iterator,
+                                            NoConstBegin>;
+   static constexpr ConstIterator constBegin(const V& base) {
+     if constexpr (std::ranges::range<const V>) {
+       return std::make_const_iterator(std::ranges::begin(base));
      }
      else {
-       return v;
+       return NoConstBegin{};
      }
    }
- private:
+
    V base_ = V();
    std::ranges::iterator_t<V> beg_ = std::ranges::begin(base_);
-   // to detect broken vector begin:
-   //using InnerBaseType = std::remove_cvref_t<BaseType<V>::type>;
-   //using InnerBaseType = std::remove_cvref_t<decltype(innerBase(std::declval<V>()))>;
-   using InnerBaseType = std::remove_cvref_t<decltype(innerBase(std::declval<V>()))>;
-   InnerBaseType* innerBasePtr_ = nullptr;
-   void* innerData_ = nullptr;
-   //std::ranges::iterator_t<InnerBaseType> innerBaseBeg_{};
+   [[no_unique_address]] ConstIterator cbeg_ = constBegin(base_);
+   [[no_unique_address]] Fingerprint::type state_ = Fingerprint::of(base_);
+
  public:
   eager_begin_view() requires std::default_initializable<V> = default;
 
   constexpr eager_begin_view(V v)
-   : base_(std::move(v)), beg_{std::ranges::begin(base_)} {
-    if constexpr (IsVector<InnerBaseType>) {
-      innerBasePtr_ = &innerBase(v);
-      innerData_ = innerBasePtr_->data();
-    }
+   : base_(std::move(v)), beg_{std::ranges::begin(base_)}, cbeg_{constBegin(base_)},
+     state_{Fingerprint::of(base_)} {
   }
 
   constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
   constexpr V base() && { return std::move(base_); }
 
   constexpr auto begin()
   {
-    if constexpr (IsVector<InnerBaseType>) {
-      auto newInnerBasePtr = &innerBase(base_);
-      //std::cout << "\ntypeid:   " << typeid(innerBase(base_)).name() << '\n';
-      //std::cout << "\ntypeid:   " << typeid(typename BaseType<V>::type).name() << '\n';
-      //std::cout << "\nisvector: " << IsVector<typename BaseType<V>::type> << '\n';
-      if (newInnerBasePtr == innerBasePtr_ && newInnerBasePtr->data() != innerData_) {
-        std::cout << "\n*** BELLEVIEWS RUNTIME ERROR: " << "eager begin() no longer valid: ";
-        std::cout << "     " << (void*)(innerBasePtr_->data()) << " <=> " << innerData_ << '\n';
-        // as a workaround: copy to itself:
-        auto baseCopy = base_;
-        base_ = std::move(baseCopy);
+    if constexpr (Fingerprint::enabled) {
+      if (Fingerprint::of(base_) != state_) [[unlikely]] {
+        _intern::reportStaleBegin("eager_begin_view: begin() no longer valid (recomputed)");
+        // copy to itself to also reset caches of inner standard views:
+        if constexpr (std::copy_constructible<V>) {
+          auto baseCopy = base_;
+          base_ = std::move(baseCopy);
+        }
         beg_ = std::ranges::begin(base_);
-        innerBasePtr_ = &innerBase(base_);
-        innerData_ = innerBasePtr_->data();
-        return std::ranges::begin(*newInnerBasePtr);
+        cbeg_ = constBegin(base_);
+        state_ = Fingerprint::of(base_);
       }
     }
     return beg_;
   }
   constexpr auto begin() const
+    requires std::ranges::range<const V>
   {
-    return std::make_const_iterator(beg_);
+    if constexpr (Fingerprint::enabled) {
+      if (Fingerprint::of(base_) != state_) [[unlikely]] {
+        _intern::reportStaleBegin("eager_begin_view: begin() const no longer valid (recomputed)");
+        // we must not modify the cached begin (concurrent const iterations are fine),
+        // so compute a new begin (without updating the cache):
+        return constBegin(base_);
+      }
+    }
+    return cbeg_;
   }
   constexpr auto end()
   {
     return std::ranges::end(base_);
   }
   constexpr auto end() const
+    requires std::ranges::range<const V>
   {
     return std::make_const_sentinel(std::ranges::end(base_));
   }
@@ -160,7 +165,7 @@ inline constexpr bool std::ranges::enable_borrowed_range<belleviews::eager_begin
 // 
 // A C++ eager_begin_view adaptor for the belleviews::eager_begin_view
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 namespace _intern {
   template<typename Rg>
@@ -198,7 +203,7 @@ inline constexpr EagerBegin eager_begin;
 } // namespace belleviews
 
 
-namespace bel::views {
+BELLEVIEWS_EXPORT namespace bel::views {
   // bel::views::eager_begin :
   inline constexpr belleviews::EagerBegin eager_begin;
 }
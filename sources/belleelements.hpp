@@ -0,0 +1,425 @@
+// <belleelements.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLEELEMENTS_HPP
+#define BELLEELEMENTS_HPP
+
+#include <concepts>
+#include <ranges>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <type_traits>
+
+//*************************************************************
+// class belleviews::elements_view
+// class belleviews::keys_view
+// class belleviews::values_view
+//
+// A C++ view yielding the N-th member of tuple-like elements
+// with the following benefits compared to C++ standard views
+// - Works with all tuple-like types
+//   (types that support structured bindings via tuple_size<>, tuple_element<>
+//    and a member get<>() or a get<>() found by ADL)
+// - Iterating is stateless
+// - Can iterate over const views
+// - Concurrent iterations are safe
+// - Always propagates const
+// Because
+// - The members are accessed like structured bindings do
+// - This view does not cache anything
+// - This view yields const iterators when it is const
+// Also:
+// - yields references to the members if the underlying range yields references
+//   (so that dereferencing only adds the offset of the member)
+// - keeps the iterator category of the underlying range (up to random access)
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<std::size_t N, typename T>
+  concept has_member_get = requires (T&& t) { std::forward<T>(t).template get<N>(); };
+
+  // get<N>() as structured bindings use it:
+  template<std::size_t N, typename T>
+  constexpr decltype(auto) tupleGet(T&& t) {
+    if constexpr (has_member_get<N, T>) {
+      return std::forward<T>(t).template get<N>();
+    }
+    else {
+      using std::get;
+      return get<N>(std::forward<T>(t));
+    }
+  }
+
+  template<typename T, std::size_t N>
+  concept has_tuple_element = requires (T t) {
+    typename std::tuple_size<std::remove_cvref_t<T>>::type;
+    requires N < std::tuple_size_v<std::remove_cvref_t<T>>;
+    typename std::tuple_element_t<N, std::remove_cvref_t<T>>;
+    _intern::tupleGet<N>(t);
+  };
+}
+
+template<std::ranges::input_range V, std::size_t N>
+requires std::ranges::view<V>
+         && _intern::has_tuple_element<std::ranges::range_value_t<V>, N>
+         && _intern::has_tuple_element<std::ranges::range_reference_t<V>, N>
+class elements_view : public std::ranges::view_interface<elements_view<V, N>>
+{
+ private:
+  // one iterator and sentinel type for both the non-const and the const view
+  // (the const one iterates with const iterators of the underlying const view):
+  template<bool ConstT>
+  using VIter = typename _intern::MaybeConstIterators<ConstT, V>::iterator;
+  template<bool ConstT>
+  using VSent = typename _intern::MaybeConstIterators<ConstT, V>::sentinel;
+
+  template<bool ConstT>
+  class Iterator
+  {
+   private:
+    using VIterT = VIter<ConstT>;
+    static constexpr bool yieldsRefs = std::is_reference_v<std::iter_reference_t<VIterT>>;
+
+    static constexpr auto _s_iter_concept() {
+      if constexpr (std::ranges::random_access_range<V>)
+        return std::random_access_iterator_tag{};
+      else if constexpr (std::ranges::bidirectional_range<V>)
+        return std::bidirectional_iterator_tag{};
+      else if constexpr (std::ranges::forward_range<V>)
+        return std::forward_iterator_tag{};
+      else
+        return std::input_iterator_tag{};
+    }
+    static auto _s_iter_cat() {
+      if constexpr (!yieldsRefs || !std::ranges::forward_range<V>) {
+        return std::input_iterator_tag{};
+      }
+      else {
+        using Cat = typename std::iterator_traits<VIterT>::iterator_category;
+        if constexpr (std::derived_from<Cat, std::random_access_iterator_tag>)
+          return std::random_access_iterator_tag{};
+        else
+          return Cat{};
+      }
+    }
+
+    // the member (by value if the underlying range yields values):
+    static constexpr decltype(auto) member(std::iter_reference_t<VIterT> elem) {
+      if constexpr (yieldsRefs) {
+        return _intern::tupleGet<N>(std::forward<std::iter_reference_t<VIterT>>(elem));
+      }
+      else {
+        using MemberT = std::remove_cv_t<std::tuple_element_t<N, std::ranges::range_value_t<V>>>;
+        return static_cast<MemberT>(_intern::tupleGet<N>(std::move(elem)));
+      }
+    }
+
+   public:
+    using iterator_concept = decltype(_s_iter_concept());
+    using iterator_category = decltype(_s_iter_cat());
+    using value_type = std::remove_cvref_t<std::tuple_element_t<N, std::ranges::range_value_t<V>>>;
+    using difference_type = std::ranges::range_difference_t<V>;
+
+   private:
+    friend elements_view;
+    friend Iterator<!ConstT>;
+    template<bool> friend class Sentinel;
+    VIterT current_ = VIterT();
+
+    constexpr explicit Iterator(VIterT cur)
+     : current_{std::move(cur)} {
+    }
+
+   public:
+    Iterator() requires std::default_initializable<VIterT> = default;
+
+    constexpr Iterator(Iterator<!ConstT> i)
+      requires ConstT && std::convertible_to<VIter<false>, VIterT>
+     : current_{std::move(i.current_)} {
+    }
+
+    constexpr const VIterT& base() const& noexcept {
+      return current_;
+    }
+    constexpr VIterT base() && {
+      return std::move(current_);
+    }
+
+    constexpr decltype(auto) operator*() const {
+      return member(*current_);
+    }
+
+    constexpr Iterator& operator++() {
+      ++current_;
+      return *this;
+    }
+    constexpr void operator++(int) {
+      ++*this;
+    }
+    constexpr Iterator operator++(int) requires std::ranges::forward_range<V> {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    constexpr Iterator& operator--() requires std::ranges::bidirectional_range<V> {
+      --current_;
+      return *this;
+    }
+    constexpr Iterator operator--(int) requires std::ranges::bidirectional_range<V> {
+      auto tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    constexpr Iterator& operator+=(difference_type n) requires std::ranges::random_access_range<V> {
+      current_ += n;
+      return *this;
+    }
+    constexpr Iterator& operator-=(difference_type n) requires std::ranges::random_access_range<V> {
+      current_ -= n;
+      return *this;
+    }
+    constexpr decltype(auto) operator[](difference_type n) const requires std::ranges::random_access_range<V> {
+      return member(current_[n]);
+    }
+
+    friend constexpr bool operator==(const Iterator& x, const Iterator& y)
+      requires std::equality_comparable<VIterT> {
+      return x.current_ == y.current_;
+    }
+    friend constexpr bool operator<(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return x.current_ < y.current_;
+    }
+    friend constexpr bool operator>(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return y < x;
+    }
+    friend constexpr bool operator<=(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return !(y < x);
+    }
+    friend constexpr bool operator>=(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return !(x < y);
+    }
+
+    friend constexpr Iterator operator+(const Iterator& i, difference_type n)
+      requires std::ranges::random_access_range<V> {
+      auto r = i;
+      r += n;
+      return r;
+    }
+    friend constexpr Iterator operator+(difference_type n, const Iterator& i)
+      requires std::ranges::random_access_range<V> {
+      return i + n;
+    }
+    friend constexpr Iterator operator-(const Iterator& i, difference_type n)
+      requires std::ranges::random_access_range<V> {
+      auto r = i;
+      r -= n;
+      return r;
+    }
+    friend constexpr difference_type operator-(const Iterator& x, const Iterator& y)
+      requires std::sized_sentinel_for<VIterT, VIterT> {
+      return x.current_ - y.current_;
+    }
+  };
+
+  template<bool ConstT>
+  class Sentinel
+  {
+   private:
+    friend elements_view;
+    friend Sentinel<!ConstT>;
+    VSent<ConstT> end_ = VSent<ConstT>();
+
+    constexpr explicit Sentinel(VSent<ConstT> end)
+     : end_{std::move(end)} {
+    }
+
+    template<bool OtherConst>
+    constexpr bool equal(const Iterator<OtherConst>& i) const {
+      return i.current_ == end_;
+    }
+    template<bool OtherConst>
+    constexpr auto distanceTo(const Iterator<OtherConst>& i) const {
+      return end_ - i.current_;
+    }
+
+   public:
+    Sentinel() = default;
+
+    constexpr Sentinel(Sentinel<!ConstT> s)
+      requires ConstT && std::convertible_to<VSent<false>, VSent<true>>
+     : end_{std::move(s.end_)} {
+    }
+
+    constexpr VSent<ConstT> base() const {
+      return end_;
+    }
+
+    template<bool OtherConst>
+    requires std::sentinel_for<VSent<ConstT>, VIter<OtherConst>>
+    friend constexpr bool operator==(const Iterator<OtherConst>& i, const Sentinel& s) {
+      return s.equal(i);
+    }
+    template<bool OtherConst>
+    requires std::sized_sentinel_for<VSent<ConstT>, VIter<OtherConst>>
+    friend constexpr std::ranges::range_difference_t<V> operator-(const Sentinel& s, const Iterator<OtherConst>& i) {
+      return s.distanceTo(i);
+    }
+    template<bool OtherConst>
+    requires std::sized_sentinel_for<VSent<ConstT>, VIter<OtherConst>>
+    friend constexpr std::ranges::range_difference_t<V> operator-(const Iterator<OtherConst>& i, const Sentinel& s) {
+      return -s.distanceTo(i);
+    }
+  };
+
+ private:
+  V base_ = V();
+
+ public:
+  elements_view() requires std::default_initializable<V> = default;
+
+  constexpr explicit elements_view(V base)
+   : base_(std::move(base)) {
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { return std::move(base_); }
+
+  constexpr auto begin() {
+    return Iterator<false>{std::ranges::begin(base_)};
+  }
+  constexpr auto begin() const requires std::ranges::input_range<const V> {
+    return Iterator<true>{std::make_const_iterator(std::ranges::begin(base_))};
+  }
+
+  constexpr auto end() {
+    if constexpr (std::ranges::common_range<V>) {
+      return Iterator<false>{std::ranges::end(base_)};
+    }
+    else {
+      return Sentinel<false>{std::ranges::end(base_)};
+    }
+  }
+  constexpr auto end() const requires std::ranges::input_range<const V> {
+    if constexpr (std::ranges::common_range<const V>) {
+      return Iterator<true>{std::make_const_iterator(std::ranges::end(base_))};
+    }
+    else {
+      return Sentinel<true>{std::make_const_sentinel(std::ranges::end(base_))};
+    }
+  }
+
+  constexpr auto size() requires std::ranges::sized_range<V> {
+    return std::ranges::size(base_);
+  }
+  constexpr auto size() const requires std::ranges::sized_range<const V> {
+    return std::ranges::size(base_);
+  }
+};
+
+template<typename V>
+using keys_view = elements_view<V, 0>;
+template<typename V>
+using values_view = elements_view<V, 1>;
+
+} // namespace belleviews
+
+// borrowed if underlying range is borrowed (as with std elements_view):
+template<typename V, std::size_t N>
+inline constexpr bool std::ranges::enable_borrowed_range<belleviews::elements_view<V, N>> = std::ranges::enable_borrowed_range<V>;
+
+
+//*************************************************************
+// belleviews::elements<N>()
+// belleviews::keys()
+// belleviews::values()
+// bel::views::elements<N>()
+// bel::views::keys()
+// bel::views::values()
+//
+// C++ elements_view adaptors for the belleviews::elements_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename Rg, std::size_t N>
+  concept can_elements_view = requires { elements_view<std::views::all_t<Rg>, N>(std::declval<Rg>()); };
+}
+
+template<std::size_t N>
+struct Elements {
+   // for:  bel::views::elements<N>(rg)
+   template<std::ranges::viewable_range Rg>
+   requires _intern::can_elements_view<Rg, N>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg) const {
+     return elements_view<std::views::all_t<Rg>, N>{std::forward<Rg>(rg)};
+   }
+
+   // for:  rg | bel::views::elements<N>()
+   struct PartialElements {
+   };
+
+   constexpr auto
+   operator() [[nodiscard]] () const {
+     return PartialElements{};
+   }
+
+   template<typename Rg>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialElements) {
+     return elements_view<std::views::all_t<Rg>, N>{std::forward<Rg>(rg)};
+   }
+};
+
+// belleviews::elements<N> :
+template<std::size_t N>
+inline constexpr Elements<N> elements;
+// belleviews::keys :
+inline constexpr Elements<0> keys;
+// belleviews::values :
+inline constexpr Elements<1> values;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::elements<N> :
+  template<std::size_t N>
+  inline constexpr belleviews::Elements<N> elements;
+  // bel::views::keys :
+  inline constexpr belleviews::Elements<0> keys;
+  // bel::views::values :
+  inline constexpr belleviews::Elements<1> values;
+}
+
+#endif // BELLEELEMENTS_HPP
@@ -0,0 +1,415 @@
+// <belleenumerate.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLEENUMERATE_HPP
+#define BELLEENUMERATE_HPP
+
+#include <concepts>
+#include <ranges>
+#include <iterator>
+#include <tuple>
+#include "bellezip.hpp"
+
+//*************************************************************
+// class belleviews::enumerate_view
+//
+// A C++ view yielding the index and the element of each element
+// (as zip_tuple<index, reference>, so that structured bindings can be used):
+//   for (auto [idx, elem] : coll | bel::views::enumerate()) { ... }
+// with the following benefits compared to C++ standard views
+// - Iterating is stateless
+// - Can iterate over const views
+// - Concurrent iterations are safe
+// - Always propagates const
+// Because
+// - The index is part of the iterator (no state in the view or in lambdas)
+// - This view yields const iterators when it is const
+// Also:
+// - for random-access ranges the index is the distance from the begin
+//   so that loops have only one induction variable
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<std::ranges::view V>
+requires std::ranges::input_range<V>
+class enumerate_view : public std::ranges::view_interface<enumerate_view<V>>
+{
+ private:
+  // one iterator and sentinel type for both the non-const and the const view
+  // (the const one iterates with const iterators of the underlying const view):
+  template<bool ConstT>
+  using VIter = typename _intern::MaybeConstIterators<ConstT, V>::iterator;
+  template<bool ConstT>
+  using VSent = typename _intern::MaybeConstIterators<ConstT, V>::sentinel;
+
+  static constexpr bool isRandomAccess = std::ranges::random_access_range<V>;
+
+  template<bool ConstT>
+  class Iterator
+  {
+   private:
+    using VIterT = VIter<ConstT>;
+
+    static constexpr auto _s_iter_concept() {
+      if constexpr (std::ranges::random_access_range<V>)
+        return std::random_access_iterator_tag{};
+      else if constexpr (std::ranges::bidirectional_range<V>)
+        return std::bidirectional_iterator_tag{};
+      else if constexpr (std::ranges::forward_range<V>)
+        return std::forward_iterator_tag{};
+      else
+        return std::input_iterator_tag{};
+    }
+
+   public:
+    using iterator_category = std::input_iterator_tag;   // operator* yields prvalues
+    using iterator_concept = decltype(_s_iter_concept());
+    using difference_type = std::ranges::range_difference_t<V>;
+    using value_type = std::tuple<difference_type, std::ranges::range_value_t<V>>;
+    using reference = zip_tuple<difference_type, std::iter_reference_t<VIterT>>;
+
+   private:
+    friend enumerate_view;
+    friend Iterator<!ConstT>;
+    template<bool> friend class Sentinel;
+
+    // - random-access ranges: the begin of the range (the index is the distance to it)
+    // - other ranges:         the index
+    using IndexT = std::conditional_t<isRandomAccess, VIterT, difference_type>;
+
+    VIterT current_ = VIterT();
+    IndexT index_ = IndexT();
+
+    constexpr Iterator(VIterT cur, IndexT idx)
+     : current_{std::move(cur)}, index_{std::move(idx)} {
+    }
+
+   public:
+    Iterator() requires std::default_initializable<VIterT> = default;
+
+    constexpr Iterator(Iterator<!ConstT> i)
+      requires ConstT && std::convertible_to<VIter<false>, VIterT>
+     : current_{std::move(i.current_)}, index_{std::move(i.index_)} {
+    }
+
+    constexpr const VIterT& base() const& noexcept {
+      return current_;
+    }
+    constexpr VIterT base() && {
+      return std::move(current_);
+    }
+
+    constexpr difference_type index() const {
+      if constexpr (isRandomAccess) {
+        return current_ - index_;
+      }
+      else {
+        return index_;
+      }
+    }
+
+    constexpr reference operator*() const {
+      return reference{index(), *current_};
+    }
+
+    constexpr Iterator& operator++() {
+      ++current_;
+      if constexpr (!isRandomAccess) {
+        ++index_;
+      }
+      return *this;
+    }
+    constexpr void operator++(int) {
+      ++*this;
+    }
+    constexpr Iterator operator++(int) requires std::ranges::forward_range<V> {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    constexpr Iterator& operator--() requires std::ranges::bidirectional_range<V> {
+      --current_;
+      if constexpr (!isRandomAccess) {
+        --index_;
+      }
+      return *this;
+    }
+    constexpr Iterator operator--(int) requires std::ranges::bidirectional_range<V> {
+      auto tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    constexpr Iterator& operator+=(difference_type n) requires std::ranges::random_access_range<V> {
+      current_ += n;
+      return *this;
+    }
+    constexpr Iterator& operator-=(difference_type n) requires std::ranges::random_access_range<V> {
+      current_ -= n;
+      return *this;
+    }
+    constexpr reference operator[](difference_type n) const requires std::ranges::random_access_range<V> {
+      return reference{index() + n, current_[n]};
+    }
+
+    friend constexpr bool operator==(const Iterator& x, const Iterator& y)
+      requires std::equality_comparable<VIterT> {
+      return x.current_ == y.current_;
+    }
+    friend constexpr bool operator<(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return x.current_ < y.current_;
+    }
+    friend constexpr bool operator>(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return y < x;
+    }
+    friend constexpr bool operator<=(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return !(y < x);
+    }
+    friend constexpr bool operator>=(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return !(x < y);
+    }
+
+    friend constexpr Iterator operator+(const Iterator& i, difference_type n)
+      requires std::ranges::random_access_range<V> {
+      auto r = i;
+      r += n;
+      return r;
+    }
+    friend constexpr Iterator operator+(difference_type n, const Iterator& i)
+      requires std::ranges::random_access_range<V> {
+      return i + n;
+    }
+    friend constexpr Iterator operator-(const Iterator& i, difference_type n)
+      requires std::ranges::random_access_range<V> {
+      auto r = i;
+      r -= n;
+      return r;
+    }
+    friend constexpr difference_type operator-(const Iterator& x, const Iterator& y)
+      requires std::sized_sentinel_for<VIterT, VIterT> {
+      return x.current_ - y.current_;
+    }
+
+    friend constexpr auto iter_move(const Iterator& i)
+      noexcept(noexcept(std::ranges::iter_move(i.current_))) {
+      using RRef = zip_tuple<difference_type, std::iter_rvalue_reference_t<VIterT>>;
+      return RRef{i.index(), std::ranges::iter_move(i.current_)};
+    }
+  };
+
+  template<bool ConstT>
+  class Sentinel
+  {
+   private:
+    friend enumerate_view;
+    friend Sentinel<!ConstT>;
+    VSent<ConstT> end_ = VSent<ConstT>();
+
+    constexpr explicit Sentinel(VSent<ConstT> end)
+     : end_{std::move(end)} {
+    }
+
+    template<bool OtherConst>
+    constexpr bool equal(const Iterator<OtherConst>& i) const {
+      return i.current_ == end_;
+    }
+    template<bool OtherConst>
+    constexpr auto distanceTo(const Iterator<OtherConst>& i) const {
+      return end_ - i.current_;
+    }
+
+   public:
+    Sentinel() = default;
+
+    constexpr Sentinel(Sentinel<!ConstT> s)
+      requires ConstT && std::convertible_to<VSent<false>, VSent<true>>
+     : end_{std::move(s.end_)} {
+    }
+
+    constexpr VSent<ConstT> base() const {
+      return end_;
+    }
+
+    template<bool OtherConst>
+    requires std::sentinel_for<VSent<ConstT>, VIter<OtherConst>>
+    friend constexpr bool operator==(const Iterator<OtherConst>& i, const Sentinel& s) {
+      return s.equal(i);
+    }
+    template<bool OtherConst>
+    requires std::sized_sentinel_for<VSent<ConstT>, VIter<OtherConst>>
+    friend constexpr std::ranges::range_difference_t<V> operator-(const Sentinel& s, const Iterator<OtherConst>& i) {
+      return s.distanceTo(i);
+    }
+    template<bool OtherConst>
+    requires std::sized_sentinel_for<VSent<ConstT>, VIter<OtherConst>>
+    friend constexpr std::ranges::range_difference_t<V> operator-(const Iterator<OtherConst>& i, const Sentinel& s) {
+      return -s.distanceTo(i);
+    }
+  };
+
+ private:
+  V base_ = V();
+
+  template<bool ConstT, typename Self>
+  static constexpr auto beginImpl(Self& self) {
+    VIter<ConstT> beg = [&] {
+                          if constexpr (ConstT) {
+                            return std::make_const_iterator(std::ranges::begin(self.base_));
+                          }
+                          else {
+                            return std::ranges::begin(self.base_);
+                          }
+                        }();
+    if constexpr (isRandomAccess) {
+      return Iterator<ConstT>{beg, beg};
+    }
+    else {
+      return Iterator<ConstT>{std::move(beg), std::ranges::range_difference_t<V>(0)};
+    }
+  }
+  template<bool ConstT, typename Self>
+  static constexpr auto endImpl(Self& self) {
+    using Base = _intern::maybe_const_t<ConstT, V>;
+    if constexpr (std::ranges::common_range<Base> && isRandomAccess) {
+      auto pos = beginImpl<ConstT>(self);
+      pos.current_ = std::ranges::next(pos.current_, std::ranges::distance(self.base_));
+      return pos;
+    }
+    else if constexpr (std::ranges::common_range<Base> && std::ranges::sized_range<Base>) {
+      VIter<ConstT> end = [&] {
+                            if constexpr (ConstT) {
+                              return std::make_const_iterator(std::ranges::end(self.base_));
+                            }
+                            else {
+                              return std::ranges::end(self.base_);
+                            }
+                          }();
+      return Iterator<ConstT>{std::move(end), std::ranges::distance(self.base_)};
+    }
+    else if constexpr (ConstT) {
+      return Sentinel<true>{std::make_const_sentinel(std::ranges::end(self.base_))};
+    }
+    else {
+      return Sentinel<false>{std::ranges::end(self.base_)};
+    }
+  }
+
+ public:
+  enumerate_view() requires std::default_initializable<V> = default;
+
+  constexpr explicit enumerate_view(V base)
+   : base_(std::move(base)) {
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { return std::move(base_); }
+
+  constexpr auto begin() {
+    return beginImpl<false>(*this);
+  }
+  constexpr auto begin() const requires std::ranges::input_range<const V> {
+    return beginImpl<true>(*this);
+  }
+
+  constexpr auto end() {
+    return endImpl<false>(*this);
+  }
+  constexpr auto end() const requires std::ranges::input_range<const V> {
+    return endImpl<true>(*this);
+  }
+
+  constexpr auto size() requires std::ranges::sized_range<V> {
+    return std::ranges::size(base_);
+  }
+  constexpr auto size() const requires std::ranges::sized_range<const V> {
+    return std::ranges::size(base_);
+  }
+};
+
+template<typename R>
+enumerate_view(R&&) -> enumerate_view<std::views::all_t<R>>;
+
+} // namespace belleviews
+
+// borrowed if underlying range is borrowed (as with std enumerate_view):
+template<typename V>
+inline constexpr bool std::ranges::enable_borrowed_range<belleviews::enumerate_view<V>> = std::ranges::enable_borrowed_range<V>;
+
+
+//*************************************************************
+// belleviews::enumerate()
+// bel::views::enumerate()
+//
+// A C++ enumerate_view adaptor for the belleviews::enumerate_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename Rg>
+  concept can_enumerate_view = requires { enumerate_view(std::declval<Rg>()); };
+}
+
+struct Enumerate {
+   // for:  bel::views::enumerate(rg)
+   template<std::ranges::viewable_range Rg>
+   requires _intern::can_enumerate_view<Rg>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg) const {
+     return enumerate_view{std::forward<Rg>(rg)};
+   }
+
+   // for:  rg | bel::views::enumerate()
+   struct PartialEnumerate {
+   };
+
+   constexpr auto
+   operator() [[nodiscard]] () const {
+     return PartialEnumerate{};
+   }
+
+   template<typename Rg>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialEnumerate) {
+     return enumerate_view{std::forward<Rg>(rg)};
+   }
+};
+
+// belleviews::enumerate :
+inline constexpr Enumerate enumerate;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::enumerate :
+  inline constexpr belleviews::Enumerate enumerate;
+}
+
+#endif // BELLEENUMERATE_HPP
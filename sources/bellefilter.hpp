@@ -31,7 +31,6 @@
 #include <concepts>
 #include <ranges>
 #include <cassert>
-#include <optional>
 
 //*************************************************************
 // class belleviews::filter_view
@@ -49,7 +48,7 @@
 // OPEN/TODO:
 // - concept and category
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 namespace _intern
 {
@@ -80,6 +79,14 @@ requires std::ranges::view<V> && std::is_object_v<Pred>
 class filter_view : public std::ranges::view_interface<filter_view<V, Pred>>
 {
  private:
+  // one iterator and sentinel type for both the non-const and the const view
+  // (the const one iterates with const iterators of the underlying const view):
+  template<bool ConstT>
+  using VIter = typename _intern::MaybeConstIterators<ConstT, V>::iterator;
+  template<bool ConstT>
+  using VSent = typename _intern::MaybeConstIterators<ConstT, V>::sentinel;
+
+  template<bool ConstT>
   struct Iterator : _intern::filter_view_iter_cat<V>
   {
    private:
@@ -100,18 +107,20 @@ class filter_view : public std::ranges::view_interface<filter_view<V, Pred>>
 
    private:
     friend filter_view;
-    using VIterT = std::ranges::iterator_t<V>;
-    const filter_view* filterViewPtr = nullptr;           // view we iterate over
+    using Parent = _intern::maybe_const_t<ConstT, filter_view>;
+    using VIterT = VIter<ConstT>;
+    Parent* filterViewPtr = nullptr;                      // view we iterate over
     VIterT current_ = VIterT();                           // current position
-    std::optional<V> base_ = {};                          // view my not be def.constructible
-    //[[no_unique_address]] _intern::SemiregBox<Pred> pred_;     // TODO: better?
-    Pred pred_;
 
    public:
     Iterator() requires std::default_initializable<VIterT> = default;  // requires not in standard
-    constexpr Iterator(filter_view* pFv, VIterT cur)
+    constexpr Iterator(Parent* pFv, VIterT cur)
      : filterViewPtr{pFv}, current_(std::move(cur)) {
     }
+    constexpr Iterator(Iterator<!ConstT> i)
+      requires ConstT && std::convertible_to<VIter<false>, VIterT>
+     : filterViewPtr{i.filterViewPtr}, current_(std::move(i.current_)) {
+    }
 
     constexpr const VIterT& base() const& noexcept {
       return current_;
@@ -120,7 +129,7 @@ class filter_view : public std::ranges::view_interface<filter_view<V, Pred>>
       return std::move(current_);
     }
 
-    constexpr std::ranges::range_reference_t<V> operator*() const {
+    constexpr std::iter_reference_t<VIterT> operator*() const {
       return *current_;
     }
     constexpr VIterT operator->() const
@@ -128,10 +137,13 @@ class filter_view : public std::ranges::view_interface<filter_view<V, Pred>>
       return current_;
     }
 
+    // the only increment (same code for the non-const and the const view):
     constexpr Iterator& operator++() {
-      current_ = std::ranges::find_if(std::move(++current_),
-                                      std::ranges::end(filterViewPtr->base_),
-                                      std::ref(*filterViewPtr->pred_));
+      auto end = std::ranges::end(filterViewPtr->base_);
+      do {
+        ++current_;
+      }
+      while (current_ != end && !std::invoke(*filterViewPtr->pred_, *current_));
       return *this;
     }
     constexpr void operator++(int) {
@@ -160,7 +172,7 @@ class filter_view : public std::ranges::view_interface<filter_view<V, Pred>>
       requires std::equality_comparable<VIterT> {
         return x.current_ == y.current_;
     }
-    friend constexpr std::ranges::range_rvalue_reference_t<V> iter_move(const Iterator& i)
+    friend constexpr std::iter_rvalue_reference_t<VIterT> iter_move(const Iterator& i)
       noexcept(noexcept(std::ranges::iter_move(i.current_))) {
         return std::ranges::iter_move(i.current_);
     }
@@ -169,141 +181,29 @@ class filter_view : public std::ranges::view_interface<filter_view<V, Pred>>
       requires std::indirectly_swappable<VIterT> {
         std::ranges::iter_swap(x.current_, y.current_);
     }
-  };
-
-  struct ConstIterator : _intern::filter_view_iter_cat<V>
-  {
-   private:
-    static constexpr auto _s_iter_concept() {
-      if constexpr (std::ranges::bidirectional_range<V>)
-        return std::bidirectional_iterator_tag{};
-      else if constexpr (std::ranges::forward_range<V>)
-        return std::forward_iterator_tag{};
-      else
-        return std::input_iterator_tag{};
-    }
-
-   public:
-    using iterator_concept = decltype(_s_iter_concept());
-    //using iterator_category = FROM BASE CLASS _intern::filter_view_iter_cat<V>
-    using value_type = std::ranges::range_value_t<V>;
-    using difference_type = std::ranges::range_difference_t<V>;
-
-   private:
-    friend filter_view;
-    using VIterT = _intern::const_iterator_t<V>;
-    const filter_view* filterViewPtr = nullptr;           // view we iterate over
-    VIterT current_ = VIterT();                           // current position
-    std::optional<V> base_ = {};                          // view my not be def.constructible
-    //[[no_unique_address]] _intern::SemiregBox<Pred> pred_;     // TODO: better?
-    Pred pred_;
-
-   public:
-    ConstIterator() requires std::default_initializable<VIterT> = default;  // requires not in standard
-    constexpr ConstIterator(const filter_view* pFv, VIterT cur)
-     : filterViewPtr{pFv}, current_(std::move(cur)) {
-    }
-
-    constexpr const VIterT& base() const& noexcept {
-      return current_;
-    }
-    constexpr VIterT base() && {
-      return std::move(current_);
-    }
-
-    constexpr _intern::range_const_reference_t<V> operator*() const {
-      return *current_;
-    }
-    constexpr VIterT operator->() const
-        requires _intern::has_arrow<VIterT> && std::copyable<VIterT> {
-      return current_;
-    }
-
-    constexpr ConstIterator& operator++() {
-      auto end = std::ranges::end(filterViewPtr->base_);
-      //current_ = std::ranges::find_if(std::move(++current_),
-      //                                end,
-      //                                std::ref(*filterViewPtr->pred_));
-      do {
-        ++current_;
-      }
-      while (current_ != end && !std::invoke(*filterViewPtr->pred_, *current_));
-      return *this;
-    }
-    constexpr void operator++(int) {
-      ++*this;
-    }
-    constexpr ConstIterator operator++(int) requires std::ranges::forward_range<V> {
-      auto tmp = *this;
-      ++*this;
-      return tmp;
-    }
-
-    constexpr ConstIterator& operator--() requires std::ranges::bidirectional_range<V> {
-      do {
-        --current_;
-      }
-      while (!std::invoke(*filterViewPtr->pred_, *current_));
-      return *this;
-    }
-    constexpr ConstIterator operator--(int) requires std::ranges::bidirectional_range<V> {
-      auto tmp = *this;
-      --*this;
-      return tmp;
-    }
 
-    friend constexpr bool operator==(const ConstIterator& x, const ConstIterator& y)
-      requires std::equality_comparable<VIterT> {
-        return x.current_ == y.current_;
-    }
-    friend constexpr _intern::range_const_rvalue_reference_t<V> iter_move(const ConstIterator& i)
-      noexcept(noexcept(std::ranges::iter_move(i.current_))) {
-        return std::ranges::iter_move(i.current_);
-    }
-    friend constexpr void iter_swap(const ConstIterator& x, const ConstIterator& y)
-      noexcept(noexcept(std::ranges::iter_swap(x.current_, y.current_)))
-      requires std::indirectly_swappable<VIterT> {
-        std::ranges::iter_swap(x.current_, y.current_);
-    }
+    friend Iterator<!ConstT>;
+    template<bool> friend class Sentinel;
   };
 
-
- private:
+  template<bool ConstT>
   class Sentinel {
    private:
-     std::ranges::sentinel_t<V> end_ = std::ranges::sentinel_t<V>(); // exposition only
+     using Parent = _intern::maybe_const_t<ConstT, filter_view>;
+     VSent<ConstT> end_ = VSent<ConstT>(); // exposition only
 
-     constexpr bool equal(const Iterator& i) const {
+     constexpr bool equal(const Iterator<ConstT>& i) const {
        return i.current_ == end_;
      }
    public:
     Sentinel() = default;
-    constexpr explicit Sentinel(filter_view* filterViewPtr)
-     : end_{std::ranges::end(filterViewPtr->base_)} {
-    }
-    constexpr std::ranges::sentinel_t<V> base() const {
-      return end_;
-    }
-    friend constexpr bool operator==(const Iterator& x, const Sentinel& y) {
-      return y.equal(x);
-    }
-  };
-  class ConstSentinel {
-   private:
-     _intern::const_sentinel_t<V> end_ = _intern::const_sentinel_t<V>(); // exposition only
-
-     constexpr bool equal(const ConstIterator& i) const {
-       return i.current_ == end_;
-     }
-   public:
-    ConstSentinel() = default;
-    constexpr explicit ConstSentinel(const filter_view* filterViewPtr)
+    constexpr explicit Sentinel(Parent* filterViewPtr)
      : end_{std::ranges::end(filterViewPtr->base_)} {
     }
-    constexpr _intern::const_sentinel_t<V> base() const {
+    constexpr VSent<ConstT> base() const {
       return end_;
     }
-    friend constexpr bool operator==(const ConstIterator& x, const ConstSentinel& y) {
+    friend constexpr bool operator==(const Iterator<ConstT>& x, const Sentinel& y) {
       return y.equal(x);
     }
   };
@@ -322,41 +222,40 @@ class filter_view : public std::ranges::view_interface<filter_view<V, Pred>>
   }
 
   constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
   constexpr V base() && { return std::move(base_); }
   constexpr const Pred& pred() const {
     return *pred_;
   }
 
-  constexpr Iterator begin() {
+  constexpr Iterator<false> begin() {
     //std::cout << "filter_view::begin()\n";
     assert(pred_.has_value());
     auto it = std::ranges::find_if(std::ranges::begin(base_),
                                    std::ranges::end(base_),
                                    std::ref(*pred_));
-    return Iterator{this, std::move(it)};
+    return Iterator<false>{this, std::move(it)};
   }
-  constexpr ConstIterator begin() const {
+  constexpr Iterator<true> begin() const requires std::ranges::range<const V> {
     //std::cout << "filter_view::begin() const\n";
     assert(pred_.has_value());
     auto it = std::ranges::find_if(std::ranges::begin(base_),
                                    std::ranges::end(base_),
                                    std::ref(*pred_));
-    return ConstIterator{this, std::move(it)};
-    //return std::make_const_iterator(Iterator{this, std::move(it)});
+    return Iterator<true>{this, std::move(it)};
   }
 
   constexpr auto end() {
     if constexpr (std::ranges::common_range<V>)
-      return Iterator{this, std::ranges::end(base_)};
+      return Iterator<false>{this, std::ranges::end(base_)};
     else
-      return Sentinel{this};
+      return Sentinel<false>{this};
   }
-  constexpr auto end() const {
+  constexpr auto end() const requires std::ranges::range<const V> {
     if constexpr (std::ranges::common_range<V>)
-      return ConstIterator{this, std::ranges::end(base_)};
-      //return std::make_const_iterator(Iterator{this, std::ranges::end(base_)});
+      return Iterator<true>{this, std::ranges::end(base_)};
     else
-      return ConstSentinel{this};
+      return Sentinel<true>{this};
   }
 };
 
@@ -376,7 +275,7 @@ filter_view(R&&, Pred) -> filter_view<std::views::all_t<R>, Pred>;
 // 
 // A C++ filter_view adaptor for the belleviews::filter_view
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 namespace _intern {
   template<typename Rg, typename Pred>
@@ -417,7 +316,7 @@ inline constexpr Filter filter;
 } // namespace belleviews
 
 
-namespace bel::views {
+BELLEVIEWS_EXPORT namespace bel::views {
   // bel::views::filter() :
   inline constexpr belleviews::Filter filter;
 }
@@ -0,0 +1,354 @@
+// <bellejoin.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLEJOIN_HPP
+#define BELLEJOIN_HPP
+
+#include <concepts>
+#include <ranges>
+#include <iterator>
+#include <type_traits>
+#include "bellesub.hpp"
+
+//*************************************************************
+// class belleviews::join_view
+//
+// A C++ view iterating over the elements of nested ranges
+// (e.g. over all elements of a std::vector<std::vector<Record>>)
+// with the following benefits compared to C++ standard views
+// - Iterating is stateless
+// - Can iterate over const views
+// - Concurrent iterations are safe
+// - Always propagates const
+// Because
+// - This view does not cache anything
+//   (the inner ranges have to be referenced, so that they don't have to be cached)
+// - This view yields const iterators of the outer and inner ranges when it is const
+// Also:
+// - for_each_segment(op) calls op for each inner range
+//   so that algorithms (see bellesegmented.hpp) run a tight loop per inner range
+//   instead of checking the inner end and reloading the outer position with each element
+// OPEN/TODO:
+// - inner ranges that are prvalues (they would have to be cached)
+// - input ranges
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<std::ranges::view V>
+requires std::ranges::forward_range<V>
+         && std::is_reference_v<std::ranges::range_reference_t<V>>
+         && std::ranges::forward_range<std::ranges::range_reference_t<V>>
+class join_view : public std::ranges::view_interface<join_view<V>>
+{
+ private:
+  // one iterator type for both the non-const and the const view
+  // (the const one iterates with const iterators of the underlying const outer and inner ranges):
+  template<bool ConstT>
+  using OuterIter = typename _intern::MaybeConstIterators<ConstT, V>::iterator;
+  template<bool ConstT>
+  using OuterSent = typename _intern::MaybeConstIterators<ConstT, V>::sentinel;
+  template<bool ConstT>
+  using InnerRng = std::remove_reference_t<std::iter_reference_t<OuterIter<ConstT>>>;
+  template<bool ConstT>
+  using InnerIter = typename _intern::MaybeConstIterators<ConstT, InnerRng<ConstT>>::iterator;
+
+  template<bool ConstT>
+  static constexpr InnerIter<ConstT> innerBegin(InnerRng<ConstT>& rg) {
+    if constexpr (ConstT) {
+      return std::make_const_iterator(std::ranges::begin(rg));
+    }
+    else {
+      return std::ranges::begin(rg);
+    }
+  }
+  template<bool ConstT>
+  static constexpr auto innerEnd(InnerRng<ConstT>& rg) {
+    if constexpr (ConstT) {
+      return std::make_const_sentinel(std::ranges::end(rg));
+    }
+    else {
+      return std::ranges::end(rg);
+    }
+  }
+
+  static constexpr bool isBidirectional = std::ranges::bidirectional_range<V>
+                                          && std::ranges::bidirectional_range<std::ranges::range_reference_t<V>>
+                                          && std::ranges::common_range<std::ranges::range_reference_t<V>>;
+
+  template<bool ConstT>
+  class Iterator
+  {
+   private:
+    using OuterIterT = OuterIter<ConstT>;
+    using OuterSentT = OuterSent<ConstT>;
+    using InnerIterT = InnerIter<ConstT>;
+
+    static constexpr auto _s_iter_concept() {
+      if constexpr (isBidirectional)
+        return std::bidirectional_iterator_tag{};
+      else
+        return std::forward_iterator_tag{};
+    }
+    static auto _s_iter_cat() {
+      using OuterCat = typename std::iterator_traits<OuterIterT>::iterator_category;
+      using InnerCat = typename std::iterator_traits<InnerIterT>::iterator_category;
+      if constexpr (isBidirectional
+                    && std::derived_from<OuterCat, std::bidirectional_iterator_tag>
+                    && std::derived_from<InnerCat, std::bidirectional_iterator_tag>)
+        return std::bidirectional_iterator_tag{};
+      else if constexpr (std::derived_from<OuterCat, std::forward_iterator_tag>
+                         && std::derived_from<InnerCat, std::forward_iterator_tag>)
+        return std::forward_iterator_tag{};
+      else
+        return std::input_iterator_tag{};
+    }
+
+   public:
+    using iterator_concept = decltype(_s_iter_concept());
+    using iterator_category = decltype(_s_iter_cat());
+    using value_type = std::iter_value_t<InnerIterT>;
+    using difference_type = std::common_type_t<std::iter_difference_t<OuterIterT>,
+                                               std::iter_difference_t<InnerIterT>>;
+
+   private:
+    friend join_view;
+    friend Iterator<!ConstT>;
+    OuterIterT outer_ = OuterIterT();
+    OuterSentT outerEnd_ = OuterSentT();
+    InnerIterT inner_ = InnerIterT();   // value-initialized at the end
+
+    constexpr Iterator(OuterIterT outer, OuterSentT outerEnd)
+     : outer_{std::move(outer)}, outerEnd_{std::move(outerEnd)} {
+      satisfy();
+    }
+
+    // skip empty inner ranges:
+    constexpr void satisfy() {
+      for (; outer_ != outerEnd_; ++outer_) {
+        auto& inner = *outer_;
+        inner_ = innerBegin<ConstT>(inner);
+        if (inner_ != innerEnd<ConstT>(inner)) {
+          return;
+        }
+      }
+      inner_ = InnerIterT();
+    }
+
+   public:
+    Iterator() = default;
+
+    constexpr Iterator(Iterator<!ConstT> i)
+      requires ConstT && std::convertible_to<OuterIter<false>, OuterIterT>
+                      && std::convertible_to<OuterSent<false>, OuterSentT>
+                      && std::convertible_to<InnerIter<false>, InnerIterT>
+     : outer_{std::move(i.outer_)}, outerEnd_{std::move(i.outerEnd_)}, inner_{std::move(i.inner_)} {
+    }
+
+    constexpr const OuterIterT& outer() const noexcept {
+      return outer_;
+    }
+    constexpr const InnerIterT& inner() const noexcept {
+      return inner_;
+    }
+
+    constexpr std::iter_reference_t<InnerIterT> operator*() const {
+      return *inner_;
+    }
+
+    constexpr Iterator& operator++() {
+      if (++inner_ == innerEnd<ConstT>(*outer_)) {
+        ++outer_;
+        satisfy();
+      }
+      return *this;
+    }
+    constexpr Iterator operator++(int) {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    constexpr Iterator& operator--() requires isBidirectional {
+      if (outer_ == outerEnd_) {
+        --outer_;
+        inner_ = innerEnd<ConstT>(*outer_);
+      }
+      while (inner_ == innerBegin<ConstT>(*outer_)) {
+        --outer_;
+        inner_ = innerEnd<ConstT>(*outer_);
+      }
+      --inner_;
+      return *this;
+    }
+    constexpr Iterator operator--(int) requires isBidirectional {
+      auto tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    friend constexpr bool operator==(const Iterator& x, const Iterator& y) {
+      return x.outer_ == y.outer_ && x.inner_ == y.inner_;
+    }
+    friend constexpr bool operator==(const Iterator& x, std::default_sentinel_t) {
+      return x.outer_ == x.outerEnd_;
+    }
+
+    friend constexpr std::iter_rvalue_reference_t<InnerIterT> iter_move(const Iterator& i)
+      noexcept(noexcept(std::ranges::iter_move(i.inner_))) {
+      return std::ranges::iter_move(i.inner_);
+    }
+  };
+
+ private:
+  V base_ = V();
+
+  template<bool ConstT, typename Self>
+  static constexpr OuterIter<ConstT> outerBegin(Self& self) {
+    if constexpr (ConstT) {
+      return std::make_const_iterator(std::ranges::begin(self.base_));
+    }
+    else {
+      return std::ranges::begin(self.base_);
+    }
+  }
+  template<bool ConstT, typename Self>
+  static constexpr OuterSent<ConstT> outerEnd(Self& self) {
+    if constexpr (ConstT) {
+      return std::make_const_sentinel(std::ranges::end(self.base_));
+    }
+    else {
+      return std::ranges::end(self.base_);
+    }
+  }
+
+  template<bool ConstT, typename Self>
+  static constexpr auto endImpl(Self& self) {
+    if constexpr (std::ranges::common_range<_intern::maybe_const_t<ConstT, V>>) {
+      return Iterator<ConstT>{outerEnd<ConstT>(self), outerEnd<ConstT>(self)};
+    }
+    else {
+      return std::default_sentinel;
+    }
+  }
+
+ public:
+  join_view() requires std::default_initializable<V> = default;
+
+  constexpr explicit join_view(V base)
+   : base_(std::move(base)) {
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { return std::move(base_); }
+
+  constexpr auto begin() {
+    return Iterator<false>{outerBegin<false>(*this), outerEnd<false>(*this)};
+  }
+  constexpr auto begin() const requires std::ranges::forward_range<const V> {
+    return Iterator<true>{outerBegin<true>(*this), outerEnd<true>(*this)};
+  }
+
+  constexpr auto end() {
+    return endImpl<false>(*this);
+  }
+  constexpr auto end() const requires std::ranges::forward_range<const V> {
+    return endImpl<true>(*this);
+  }
+
+  // the segmented structure:
+  // - calls op for each inner range (as sub_view of const iterators if the view is const)
+  template<typename Op>
+  constexpr void for_each_segment(Op&& op) {
+    for (auto& inner : base_) {
+      op(inner);
+    }
+  }
+  template<typename Op>
+  constexpr void for_each_segment(Op&& op) const requires std::ranges::forward_range<const V> {
+    auto end = outerEnd<true>(*this);
+    for (auto pos = outerBegin<true>(*this); pos != end; ++pos) {
+      op(sub_view{innerBegin<true>(*pos), innerEnd<true>(*pos)});
+    }
+  }
+};
+
+template<typename R>
+join_view(R&&) -> join_view<std::views::all_t<R>>;
+
+} // namespace belleviews
+
+
+//*************************************************************
+// belleviews::join()
+// bel::views::join()
+//
+// A C++ join_view adaptor for the belleviews::join_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename Rg>
+  concept can_join_view = requires { join_view(std::declval<Rg>()); };
+}
+
+struct Join {
+   // for:  bel::views::join(rg)
+   template<std::ranges::viewable_range Rg>
+   requires _intern::can_join_view<Rg>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg) const {
+     // (no CTAD, which would copy join_views instead of joining them):
+     return join_view<std::views::all_t<Rg>>{std::forward<Rg>(rg)};
+   }
+
+   // for:  rg | bel::views::join()
+   struct PartialJoin {
+   };
+
+   constexpr auto
+   operator() [[nodiscard]] () const {
+     return PartialJoin{};
+   }
+
+   template<typename Rg>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialJoin) {
+     // (no CTAD, which would copy join_views instead of joining them):
+     return join_view<std::views::all_t<Rg>>{std::forward<Rg>(rg)};
+   }
+};
+
+// belleviews::join :
+inline constexpr Join join;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::join :
+  inline constexpr belleviews::Join join;
+}
+
+#endif // BELLEJOIN_HPP
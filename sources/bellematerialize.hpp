@@ -0,0 +1,176 @@
+// <bellematerialize.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+// If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef BELLEMATERIALIZE_HPP
+#define BELLEMATERIALIZE_HPP
+
+#include <concepts>
+#include <ranges>
+#include <vector>
+
+//*************************************************************
+// class belleviews::materialized<>
+// bel::materialized<>
+// 
+// The elements of a view evaluated once into an owned contiguous buffer
+// for multi-pass consumption of expensive pipelines
+// (the cost is explicit and shows up as a type in the code)
+// - Iterating is stateless
+//   - Can iterate over elements when it is const
+//   - Supports concurrent iterations
+// - Always const: the elements can't be modified
+// - random-access, sized, and contiguous
+// - refresh() evaluates the view again (reusing the capacity of the buffer)
+// NOTE:
+// - This is not a view (it owns the elements),
+//   so that using it in pipelines does not copy the elements
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<std::ranges::input_range V>
+requires std::ranges::view<V>
+         && std::constructible_from<std::ranges::range_value_t<V>, std::ranges::range_reference_t<V>>
+class materialized
+{
+ public:
+  using value_type = std::ranges::range_value_t<V>;
+  using size_type = std::size_t;
+  using iterator = typename std::vector<value_type>::const_iterator;
+  using const_iterator = iterator;
+
+ private:
+  V base_ = V();
+  std::vector<value_type> elems_;
+
+  void evaluate() {
+    elems_.clear();
+    if constexpr (std::ranges::sized_range<V>) {
+      elems_.reserve(static_cast<size_type>(std::ranges::size(base_)));
+    }
+    for (auto&& elem : base_) {
+      elems_.emplace_back(std::forward<decltype(elem)>(elem));
+    }
+  }
+
+ public:
+  materialized() requires std::default_initializable<V> = default;
+
+  constexpr explicit materialized(V v)
+   : base_(std::move(v)) {
+    evaluate();
+  }
+
+  // evaluate the view again (e.g., after modifying the underlying range):
+  void refresh() {
+    evaluate();
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { return std::move(base_); }
+
+  // only const access:
+  constexpr iterator begin() const noexcept { return elems_.cbegin(); }
+  constexpr iterator end() const noexcept { return elems_.cend(); }
+  constexpr const value_type* data() const noexcept { return elems_.data(); }
+  constexpr size_type size() const noexcept { return elems_.size(); }
+  constexpr bool empty() const noexcept { return elems_.empty(); }
+  constexpr size_type capacity() const noexcept { return elems_.capacity(); }
+
+  constexpr const value_type& operator[](size_type idx) const {
+    return elems_[idx];
+  }
+  constexpr const value_type& front() const {
+    return elems_.front();
+  }
+  constexpr const value_type& back() const {
+    return elems_.back();
+  }
+};
+
+template<typename R>
+materialized(R&&) -> materialized<std::views::all_t<R>>;
+
+} // namespace belleviews
+
+
+//*************************************************************
+// belleviews::materialize()
+// bel::views::materialize()
+// 
+// A C++ adaptor creating a belleviews::materialized<>
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename Rg>
+  concept can_materialize = requires { materialized(std::declval<Rg>()); };
+}
+
+struct Materialize {
+   // for:  bel::views::materialize(rg)
+   template<std::ranges::viewable_range Rg>
+   requires _intern::can_materialize<Rg>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg) const {
+     return materialized{std::forward<Rg>(rg)};
+   }
+
+   // for:  rg | bel::views::materialize()
+   struct PartialMaterialize {
+   };
+
+   constexpr auto
+   operator() [[nodiscard]] () const {
+     return PartialMaterialize{};
+   }
+
+   template<typename Rg>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialMaterialize) {
+     return materialized{std::forward<Rg>(rg)};
+   }
+};
+
+// belleviews::materialize :
+inline constexpr Materialize materialize;
+
+} // namespace belleviews
+
+
+BELLEVIEWS_EXPORT namespace bel {
+  // bel::materialized<> :
+  template<typename V>
+  using materialized = belleviews::materialized<V>;
+}
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::materialize :
+  inline constexpr belleviews::Materialize materialize;
+}
+
+#endif // BELLEMATERIALIZE_HPP
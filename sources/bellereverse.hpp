@@ -0,0 +1,252 @@
+// <bellereverse.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLEREVERSE_HPP
+#define BELLEREVERSE_HPP
+
+#include <concepts>
+#include <ranges>
+#include <iterator>
+#include <type_traits>
+#include "bellesub.hpp"
+#include "belletake.hpp"
+#include "belledrop.hpp"
+
+//*************************************************************
+// class belleviews::reverse_view
+//
+// A C++ view iterating over the elements in reverse order
+// with the following benefits compared to C++ standard views
+// - Iterating is stateless
+// - Can iterate over const views
+// - Concurrent iterations are safe
+// - Always propagates const
+// Because
+// - This view does not cache the end of the underlying range
+//   (std::ranges::reverse_view does if the range is not common)
+//   - computing it is O(1) for common and for random-access sized ranges
+//   - otherwise it is O(n) with each call of begin()
+// - This view yields const iterators when it is const
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<std::ranges::view V>
+requires std::ranges::bidirectional_range<V>
+class reverse_view : public std::ranges::view_interface<reverse_view<V>>
+{
+ private:
+  V base_ = V();
+
+  template<bool ConstT, typename Self>
+  static constexpr auto baseBegin(Self& self) {
+    if constexpr (ConstT) {
+      return std::make_const_iterator(std::ranges::begin(self.base_));
+    }
+    else {
+      return std::ranges::begin(self.base_);
+    }
+  }
+
+  // the end of the underlying range as iterator (without caching):
+  template<bool ConstT, typename Self>
+  static constexpr auto baseLast(Self& self) {
+    using Base = _intern::maybe_const_t<ConstT, V>;
+    if constexpr (std::ranges::common_range<Base>) {
+      if constexpr (ConstT) {
+        return std::make_const_iterator(std::ranges::end(self.base_));
+      }
+      else {
+        return std::ranges::end(self.base_);
+      }
+    }
+    else if constexpr (std::ranges::random_access_range<Base> && std::ranges::sized_range<Base>) {
+      return baseBegin<ConstT>(self) + std::ranges::distance(self.base_);
+    }
+    else {
+      return std::ranges::next(baseBegin<ConstT>(self), std::ranges::end(self.base_));
+    }
+  }
+
+ public:
+  reverse_view() requires std::default_initializable<V> = default;
+
+  constexpr explicit reverse_view(V base)
+   : base_(std::move(base)) {
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { return std::move(base_); }
+
+  constexpr auto begin() {
+    return std::make_reverse_iterator(baseLast<false>(*this));
+  }
+  constexpr auto begin() const requires std::ranges::bidirectional_range<const V> {
+    return std::make_reverse_iterator(baseLast<true>(*this));
+  }
+
+  constexpr auto end() {
+    return std::make_reverse_iterator(baseBegin<false>(*this));
+  }
+  constexpr auto end() const requires std::ranges::bidirectional_range<const V> {
+    return std::make_reverse_iterator(baseBegin<true>(*this));
+  }
+
+  constexpr auto size() requires std::ranges::sized_range<V> {
+    return std::ranges::size(base_);
+  }
+  constexpr auto size() const requires std::ranges::sized_range<const V> {
+    return std::ranges::size(base_);
+  }
+};
+
+template<typename R>
+reverse_view(R&&) -> reverse_view<std::views::all_t<R>>;
+
+} // namespace belleviews
+
+// borrowed if underlying range is borrowed (as with std reverse_view):
+template<typename V>
+inline constexpr bool std::ranges::enable_borrowed_range<belleviews::reverse_view<V>> = std::ranges::enable_borrowed_range<V>;
+
+
+//*************************************************************
+// belleviews::reverse()
+// bel::views::reverse()
+//
+// A C++ reverse_view adaptor for the belleviews::reverse_view
+// - reverse(reverse_view) yields the underlying view
+// - reverse(sub_view) of reverse iterators yields the sub_view of the underlying iterators
+// - reverse() of sub_views, drop_views, and take_views of random-access sized ranges
+//   yield a sub_view of reverse iterators of the underlying range
+//   (instead of reverse iterators of the iterators of these views)
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename T>
+  inline constexpr bool is_reverse_view = false;
+  template<typename V>
+  inline constexpr bool is_reverse_view<reverse_view<V>> = true;
+
+  template<typename T>
+  inline constexpr bool is_reversed_sub_view = false;
+  template<typename It, subrange_kind Kind>
+  inline constexpr bool is_reversed_sub_view<sub_view<std::reverse_iterator<It>, std::reverse_iterator<It>, Kind>> = true;
+
+  // views that can be reversed by reversing their begin and end
+  // (they have no state but their begin and end):
+  template<typename T>
+  inline constexpr bool is_reducible_view = false;
+  template<typename It, typename Sent, subrange_kind Kind>
+  inline constexpr bool is_reducible_view<sub_view<It, Sent, Kind>> = true;
+  template<typename V>
+  inline constexpr bool is_reducible_view<drop_view<V>> = true;
+  template<typename V>
+  inline constexpr bool is_reducible_view<take_view<V>> = true;
+
+  template<typename Rg>
+  concept reducible_to_reversed_sub_view = is_reducible_view<std::remove_cvref_t<Rg>>
+                                           && std::ranges::borrowed_range<Rg>
+                                           && std::ranges::random_access_range<Rg>
+                                           && std::ranges::sized_range<Rg>;
+
+  template<typename Rg>
+  concept can_reverse_view = requires { reverse_view(std::declval<Rg>()); };
+
+  // the underlying iterator of a reverse iterator
+  // (const reverse iterators yield const underlying iterators):
+  template<typename It>
+  constexpr auto unreverse(std::reverse_iterator<It> pos) {
+    return pos.base();
+  }
+  template<typename It>
+  constexpr auto unreverse(basic_const_iterator<std::reverse_iterator<It>> pos) {
+    return std::make_const_iterator(pos.base().base());
+  }
+
+  // reverse views of const ranges can't collapse to their (non-const) base:
+  template<typename Rg>
+  concept const_range_arg = std::is_const_v<std::remove_reference_t<Rg>>;
+}
+
+struct Reverse {
+   // for:  bel::views::reverse(rg)
+   template<std::ranges::viewable_range Rg>
+   requires _intern::can_reverse_view<Rg>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg) const {
+     using RgT = std::remove_cvref_t<Rg>;
+     if constexpr (_intern::is_reverse_view<RgT> && !_intern::const_range_arg<Rg>) {
+       return std::forward<Rg>(rg).base();
+     }
+     else if constexpr (_intern::is_reverse_view<RgT>
+                        && (std::is_lvalue_reference_v<Rg> || std::ranges::borrowed_range<Rg>)) {
+       // const reverse views collapse to the const iterators of their base:
+       return sub_view{_intern::unreverse(std::ranges::end(rg)), _intern::unreverse(std::ranges::begin(rg))};
+     }
+     else if constexpr (_intern::is_reversed_sub_view<RgT>) {
+       // (const sub_views yield const reverse iterators):
+       return sub_view{_intern::unreverse(std::ranges::end(rg)), _intern::unreverse(std::ranges::begin(rg))};
+     }
+     else if constexpr (_intern::reducible_to_reversed_sub_view<Rg>) {
+       auto beg = std::ranges::begin(rg);
+       auto end = beg + std::ranges::distance(rg);
+       return sub_view{std::make_reverse_iterator(end), std::make_reverse_iterator(beg)};
+     }
+     else {
+       // (no CTAD, which would copy reverse_views instead of reversing them):
+       return reverse_view<std::views::all_t<Rg>>{std::forward<Rg>(rg)};
+     }
+   }
+
+   // for:  rg | bel::views::reverse()
+   struct PartialReverse {
+   };
+
+   constexpr auto
+   operator() [[nodiscard]] () const {
+     return PartialReverse{};
+   }
+
+   template<typename Rg>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialReverse) {
+     return Reverse{}(std::forward<Rg>(rg));
+   }
+};
+
+// belleviews::reverse :
+inline constexpr Reverse reverse;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::reverse :
+  inline constexpr belleviews::Reverse reverse;
+}
+
+#endif // BELLEREVERSE_HPP
@@ -0,0 +1,339 @@
+// <bellerolling.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLEROLLING_HPP
+#define BELLEROLLING_HPP
+
+#include <concepts>
+#include <ranges>
+#include <iterator>
+#include <functional>
+#include <deque>
+#include <utility>
+#include <cassert>
+
+//*************************************************************
+// class belleviews::rolling_view
+// - rolling_sum(n)
+// - rolling_min(n)
+// - rolling_max(n)
+//
+// A C++ view yielding an aggregate (sum, minimum, maximum) of
+// all windows of n consecutive elements
+// (e.g., for rolling sums or min/max over time series)
+// with the following benefits compared to C++ standard views
+// - Iterating is stateless
+// - Can iterate over const views
+// - Concurrent iterations are safe
+// - Always propagates const
+// Because
+// - The aggregate is updated by each iterator
+//   (the view itself has no state but the underlying range and n)
+// - This view yields const elements when it is const
+//   (rolling_min() and rolling_max() yield references to the elements)
+// Also:
+// - each step is amortized O(1) instead of O(n):
+//   - sums add the new element and subtract the dropped element
+//   - min/max use a monotonic deque of iterators to the candidates
+//     (so that copying iterators of these views copies the deque)
+// OPEN/TODO:
+// - input ranges are not supported (they would need a buffer)
+// - rolling sums of floating-point values might accumulate rounding errors
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  // aggregates updated by each step
+  // - add() for the element entering the window
+  // - remove() for the element leaving the window
+  // - value() for the aggregate of the current window
+  template<std::forward_iterator It>
+  requires requires (std::iter_value_t<It> v, std::iter_reference_t<It> r) { v += r; v -= r; }
+  class RollingSum
+  {
+   private:
+    std::iter_value_t<It> sum_{};
+   public:
+    using reference = std::iter_value_t<It>;
+    constexpr void add(const It& pos, std::iter_difference_t<It>) {
+      sum_ += *pos;
+    }
+    constexpr void remove(const It& pos, std::iter_difference_t<It>) {
+      sum_ -= *pos;
+    }
+    constexpr reference value() const {
+      return sum_;
+    }
+  };
+
+  template<std::forward_iterator It, typename Comp>
+  requires std::indirect_strict_weak_order<Comp, It>
+  class RollingMinMax
+  {
+   private:
+    // candidates with their index (each candidate is better than all later ones):
+    std::deque<std::pair<std::iter_difference_t<It>, It>> candidates_;
+   public:
+    using reference = std::iter_reference_t<It>;
+    constexpr void add(const It& pos, std::iter_difference_t<It> idx) {
+      // later elements that are not worse make earlier candidates obsolete:
+      while (!candidates_.empty() && !Comp{}(*candidates_.back().second, *pos)) {
+        candidates_.pop_back();
+      }
+      candidates_.emplace_back(idx, pos);
+    }
+    constexpr void remove(const It&, std::iter_difference_t<It> idx) {
+      if (candidates_.front().first == idx) {
+        candidates_.pop_front();
+      }
+    }
+    constexpr reference value() const {
+      return *candidates_.front().second;
+    }
+  };
+
+  template<typename It>
+  using RollingMin = RollingMinMax<It, std::ranges::less>;
+  template<typename It>
+  using RollingMax = RollingMinMax<It, std::ranges::greater>;
+}
+
+template<std::ranges::view V, template<typename> class Agg>
+requires std::ranges::forward_range<V>
+         && requires { typename Agg<std::ranges::iterator_t<V>>; }
+class rolling_view : public std::ranges::view_interface<rolling_view<V, Agg>>
+{
+ private:
+  // one iterator type for both the non-const and the const view
+  // (the const one iterates with const iterators of the underlying const view):
+  template<bool ConstT>
+  using VIter = typename _intern::MaybeConstIterators<ConstT, V>::iterator;
+  template<bool ConstT>
+  using VSent = typename _intern::MaybeConstIterators<ConstT, V>::sentinel;
+
+  template<bool ConstT>
+  class Iterator
+  {
+   private:
+    using VIterT = VIter<ConstT>;
+    using VSentT = VSent<ConstT>;
+    using AggT = Agg<VIterT>;
+
+    static constexpr bool yieldsRefs = std::is_reference_v<typename AggT::reference>;
+
+   public:
+    using iterator_category = std::conditional_t<yieldsRefs,
+                                                 std::forward_iterator_tag,
+                                                 std::input_iterator_tag>;
+    using iterator_concept = std::forward_iterator_tag;
+    using value_type = std::remove_cvref_t<typename AggT::reference>;
+    using difference_type = std::ranges::range_difference_t<V>;
+
+   private:
+    friend rolling_view;
+    friend Iterator<!ConstT>;
+    VIterT front_ = VIterT();   // first element of the window
+    VIterT last_ = VIterT();    // last element of the window (end if there is no window)
+    VSentT end_ = VSentT();
+    difference_type n_ = 1;
+    difference_type idx_ = 0;   // index of last_
+    AggT agg_;                  // aggregate of the window
+
+    constexpr Iterator(VIterT beg, VSentT end, difference_type n)
+     : front_{beg}, last_{std::move(beg)}, end_{std::move(end)}, n_{n} {
+      // aggregate the first window:
+      for ( ; last_ != end_; ++last_, ++idx_) {
+        agg_.add(last_, idx_);
+        if (idx_ == n_ - 1) {
+          break;
+        }
+      }
+    }
+
+   public:
+    Iterator() = default;
+
+    constexpr Iterator(Iterator<!ConstT> i)
+      requires ConstT && std::convertible_to<VIter<false>, VIterT>
+                      && std::convertible_to<VSent<false>, VSentT>
+                      && std::convertible_to<Agg<VIter<false>>, AggT>
+     : front_{std::move(i.front_)}, last_{std::move(i.last_)}, end_{std::move(i.end_)},
+       n_{i.n_}, idx_{i.idx_}, agg_{std::move(i.agg_)} {
+    }
+
+    constexpr VIterT base() const {
+      return front_;
+    }
+
+    constexpr typename AggT::reference operator*() const {
+      assert(last_ != end_);
+      return agg_.value();
+    }
+
+    constexpr Iterator& operator++() {
+      ++last_;
+      ++idx_;
+      if (last_ != end_) {
+        agg_.remove(front_, idx_ - n_);
+        agg_.add(last_, idx_);
+        ++front_;
+      }
+      return *this;
+    }
+    constexpr Iterator operator++(int) {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    friend constexpr bool operator==(const Iterator& x, const Iterator& y) {
+      return x.last_ == y.last_;
+    }
+    friend constexpr bool operator==(const Iterator& x, std::default_sentinel_t) {
+      return x.last_ == x.end_;
+    }
+    friend constexpr difference_type operator-(std::default_sentinel_t, const Iterator& i)
+      requires std::sized_sentinel_for<VSentT, VIterT> {
+      return i.end_ - i.last_;
+    }
+    friend constexpr difference_type operator-(const Iterator& i, std::default_sentinel_t s)
+      requires std::sized_sentinel_for<VSentT, VIterT> {
+      return -(s - i);
+    }
+  };
+
+ private:
+  V base_ = V();
+  std::ranges::range_difference_t<V> n_ = 1;
+
+ public:
+  rolling_view() requires std::default_initializable<V> = default;
+
+  constexpr rolling_view(V base, std::ranges::range_difference_t<V> n)
+   : base_(std::move(base)), n_{n} {
+      assert(n > 0);
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { return std::move(base_); }
+
+  constexpr auto begin() {
+    return Iterator<false>{std::ranges::begin(base_), std::ranges::end(base_), n_};
+  }
+  constexpr auto begin() const requires std::ranges::forward_range<const V> {
+    return Iterator<true>{std::make_const_iterator(std::ranges::begin(base_)),
+                          std::make_const_sentinel(std::ranges::end(base_)),
+                          n_};
+  }
+
+  constexpr std::default_sentinel_t end() const noexcept {
+    return std::default_sentinel;
+  }
+
+  // number of windows in O(1):
+  constexpr auto size() requires std::ranges::sized_range<V> {
+    using SizeT = decltype(std::ranges::size(base_));
+    return _intern::numWindows(std::ranges::size(base_), static_cast<SizeT>(n_));
+  }
+  constexpr auto size() const requires std::ranges::sized_range<const V> {
+    using SizeT = decltype(std::ranges::size(base_));
+    return _intern::numWindows(std::ranges::size(base_), static_cast<SizeT>(n_));
+  }
+};
+
+} // namespace belleviews
+
+// borrowed if underlying range is borrowed:
+template<typename V, template<typename> class Agg>
+inline constexpr bool std::ranges::enable_borrowed_range<belleviews::rolling_view<V, Agg>> = std::ranges::enable_borrowed_range<V>;
+
+
+//*************************************************************
+// belleviews::rolling_sum()
+// belleviews::rolling_min()
+// belleviews::rolling_max()
+// bel::views::rolling_sum()
+// bel::views::rolling_min()
+// bel::views::rolling_max()
+//
+// C++ rolling_view adaptors for the belleviews::rolling_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename Rg, template<typename> class Agg>
+  concept can_rolling_view = requires { rolling_view<std::views::all_t<Rg>, Agg>(std::declval<Rg>(), 1); };
+}
+
+template<template<typename> class Agg>
+struct Rolling {
+   // for:  bel::views::rolling_sum(rg, 3)
+   template<std::ranges::viewable_range Rg, typename DiffT = std::ranges::range_difference_t<Rg>>
+   requires _intern::can_rolling_view<Rg, Agg>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg, DiffT n) const {
+     return rolling_view<std::views::all_t<Rg>, Agg>{std::forward<Rg>(rg), n};
+   }
+
+   // for:  rg | bel::views::rolling_sum(3)
+   template<typename T>
+   struct PartialRolling {
+     T n;
+   };
+
+   template<typename DiffT>
+   constexpr auto
+   operator() [[nodiscard]] (DiffT n) const {
+     return PartialRolling<DiffT>{n};
+   }
+
+   template<typename Rg, typename DiffT>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialRolling<DiffT> pr) {
+     return rolling_view<std::views::all_t<Rg>, Agg>{std::forward<Rg>(rg), pr.n};
+   }
+};
+
+// belleviews::rolling_sum() :
+inline constexpr Rolling<_intern::RollingSum> rolling_sum;
+// belleviews::rolling_min() :
+inline constexpr Rolling<_intern::RollingMin> rolling_min;
+// belleviews::rolling_max() :
+inline constexpr Rolling<_intern::RollingMax> rolling_max;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::rolling_sum() :
+  inline constexpr belleviews::Rolling<belleviews::_intern::RollingSum> rolling_sum;
+  // bel::views::rolling_min() :
+  inline constexpr belleviews::Rolling<belleviews::_intern::RollingMin> rolling_min;
+  // bel::views::rolling_max() :
+  inline constexpr belleviews::Rolling<belleviews::_intern::RollingMax> rolling_max;
+}
+
+#endif // BELLEROLLING_HPP
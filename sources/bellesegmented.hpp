@@ -0,0 +1,185 @@
+// <bellesegmented.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLESEGMENTED_HPP
+#define BELLESEGMENTED_HPP
+
+#include <concepts>
+#include <ranges>
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <iterator>
+
+//*************************************************************
+// segmented ranges
+//
+// Views such as join_view consist of segments (e.g. the inner ranges).
+// They provide
+//   rg.for_each_segment(op)
+// calling op for each segment, so that the algorithms below
+// iterate over each segment with a tight loop of its own.
+// For all other ranges the algorithms iterate as usual.
+// Segments can be segmented ranges again.
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  struct IgnoreSegment {
+    constexpr void operator()(auto&&) const {
+    }
+  };
+
+  template<typename Rg>
+  concept segmented_range = std::ranges::range<Rg>
+                            && requires (Rg& rg) { rg.for_each_segment(IgnoreSegment{}); };
+}
+
+//*************************************************************
+// belleviews::for_each()
+// bel::for_each()
+//
+// Calls op for each element (per segment for segmented ranges)
+// - returns op
+//*************************************************************
+struct ForEach {
+   template<std::ranges::input_range Rg, typename Op>
+   constexpr Op
+   operator() (Rg&& rg, Op op) const {
+     if constexpr (_intern::segmented_range<Rg>) {
+       rg.for_each_segment([&] (auto&& seg) {
+                             (*this)(seg, std::ref(op));
+                           });
+     }
+     else {
+       for (auto&& elem : rg) {
+         std::invoke(op, std::forward<decltype(elem)>(elem));
+       }
+     }
+     return op;
+   }
+};
+
+inline constexpr ForEach for_each;
+
+//*************************************************************
+// belleviews::count()
+// bel::count()
+//
+// Counts the elements equal to value (per segment for segmented ranges)
+//*************************************************************
+struct Count {
+   template<std::ranges::input_range Rg, typename T>
+   constexpr std::ranges::range_difference_t<Rg>
+   operator() [[nodiscard]] (Rg&& rg, const T& value) const {
+     if constexpr (_intern::segmented_range<Rg>) {
+       std::ranges::range_difference_t<Rg> num = 0;
+       rg.for_each_segment([&] (auto&& seg) {
+                             num += (*this)(seg, value);
+                           });
+       return num;
+     }
+     else {
+       return std::ranges::count(rg, value);
+     }
+   }
+};
+
+inline constexpr Count count;
+
+//*************************************************************
+// belleviews::copy()
+// bel::copy()
+//
+// Copies all elements to out (per segment for segmented ranges,
+// so that contiguous segments of trivially copyable elements use memmove())
+// - returns the position behind the last written element
+//*************************************************************
+struct Copy {
+   template<std::ranges::input_range Rg, std::weakly_incrementable Out>
+   requires std::indirectly_copyable<std::ranges::iterator_t<Rg>, Out>
+   constexpr Out
+   operator() (Rg&& rg, Out out) const {
+     if constexpr (_intern::segmented_range<Rg>) {
+       rg.for_each_segment([&] (auto&& seg) {
+                             out = (*this)(seg, std::move(out));
+                           });
+       return out;
+     }
+     else {
+       return std::ranges::copy(rg, std::move(out)).out;
+     }
+   }
+};
+
+inline constexpr Copy copy;
+
+//*************************************************************
+// belleviews::reduce()
+// bel::reduce()
+//
+// Reduces all elements with op starting with init (per segment for segmented ranges)
+// - as with std::reduce() op has to be associative and commutative
+//   so that the reduction of each segment can be vectorized
+//*************************************************************
+struct Reduce {
+   template<std::ranges::input_range Rg, typename T, typename Op = std::plus<>>
+   constexpr T
+   operator() [[nodiscard]] (Rg&& rg, T init, Op op = {}) const {
+     if constexpr (_intern::segmented_range<Rg>) {
+       rg.for_each_segment([&] (auto&& seg) {
+                             init = (*this)(seg, std::move(init), op);
+                           });
+       return init;
+     }
+     else if constexpr (std::ranges::common_range<Rg>) {
+       return std::reduce(std::ranges::begin(rg), std::ranges::end(rg), std::move(init), op);
+     }
+     else {
+       for (auto&& elem : rg) {
+         init = std::invoke(op, std::move(init), std::forward<decltype(elem)>(elem));
+       }
+       return init;
+     }
+   }
+};
+
+inline constexpr Reduce reduce;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel {
+  // bel::for_each() :
+  inline constexpr belleviews::ForEach for_each;
+  // bel::count() :
+  inline constexpr belleviews::Count count;
+  // bel::copy() :
+  inline constexpr belleviews::Copy copy;
+  // bel::reduce() :
+  inline constexpr belleviews::Reduce reduce;
+}
+
+#endif // BELLESEGMENTED_HPP
@@ -0,0 +1,340 @@
+// <belleslide.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLESLIDE_HPP
+#define BELLESLIDE_HPP
+
+#include <concepts>
+#include <ranges>
+#include <iterator>
+#include <cassert>
+#include "bellesub.hpp"
+
+//*************************************************************
+// class belleviews::slide_view
+//
+// A C++ view yielding all windows of n consecutive elements
+// (e.g., for moving averages or pattern matching)
+// with the following benefits compared to C++ standard views
+// - Iterating is stateless
+// - Can iterate over const views
+// - Concurrent iterations are safe
+// - Always propagates const
+// Because
+// - This view does not cache anything
+//   (begin() is O(1) for random-access ranges and O(n) otherwise)
+// - This view yields windows of const elements when it is const
+// - Each window is a sub_view<> of two iterators of the underlying range
+//   (so that each step only increments two iterators)
+// - size() is O(1) if the underlying range is sized
+// OPEN/TODO:
+// - input ranges are not supported (they would need a buffer)
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<std::ranges::view V>
+requires std::ranges::forward_range<V>
+class slide_view : public std::ranges::view_interface<slide_view<V>>
+{
+ private:
+  // one iterator type for both the non-const and the const view
+  // (the const one iterates with const iterators of the underlying const view):
+  template<bool ConstT>
+  using VIter = typename _intern::MaybeConstIterators<ConstT, V>::iterator;
+  template<bool ConstT>
+  using VSent = typename _intern::MaybeConstIterators<ConstT, V>::sentinel;
+
+  template<bool ConstT>
+  class Iterator
+  {
+   private:
+    using VIterT = VIter<ConstT>;
+    using VSentT = VSent<ConstT>;
+
+    static constexpr auto _s_iter_concept() {
+      if constexpr (std::ranges::random_access_range<V>)
+        return std::random_access_iterator_tag{};
+      else if constexpr (std::ranges::bidirectional_range<V>)
+        return std::bidirectional_iterator_tag{};
+      else
+        return std::forward_iterator_tag{};
+    }
+
+   public:
+    using iterator_category = std::input_iterator_tag;   // operator* yields prvalues
+    using iterator_concept = decltype(_s_iter_concept());
+    using value_type = sub_view<VIterT, VIterT>;
+    using difference_type = std::ranges::range_difference_t<V>;
+
+   private:
+    friend slide_view;
+    friend Iterator<!ConstT>;
+    VIterT current_ = VIterT();   // first element of the window
+    VIterT last_ = VIterT();      // last element of the window (end if there is no window)
+    VSentT end_ = VSentT();
+
+    constexpr Iterator(VIterT cur, VIterT last, VSentT end)
+     : current_{std::move(cur)}, last_{std::move(last)}, end_{std::move(end)} {
+    }
+
+   public:
+    Iterator() = default;
+
+    constexpr Iterator(Iterator<!ConstT> i)
+      requires ConstT && std::convertible_to<VIter<false>, VIterT>
+                      && std::convertible_to<VSent<false>, VSentT>
+     : current_{std::move(i.current_)}, last_{std::move(i.last_)}, end_{std::move(i.end_)} {
+    }
+
+    constexpr VIterT base() const {
+      return current_;
+    }
+
+    constexpr value_type operator*() const {
+      assert(last_ != end_);
+      return value_type{current_, std::ranges::next(last_)};
+    }
+
+    constexpr Iterator& operator++() {
+      ++current_;
+      ++last_;
+      return *this;
+    }
+    constexpr Iterator operator++(int) {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    constexpr Iterator& operator--() requires std::ranges::bidirectional_range<V> {
+      --current_;
+      --last_;
+      return *this;
+    }
+    constexpr Iterator operator--(int) requires std::ranges::bidirectional_range<V> {
+      auto tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    constexpr Iterator& operator+=(difference_type x) requires std::ranges::random_access_range<V> {
+      current_ += x;
+      last_ += x;
+      return *this;
+    }
+    constexpr Iterator& operator-=(difference_type x) requires std::ranges::random_access_range<V> {
+      return *this += -x;
+    }
+    constexpr value_type operator[](difference_type n) const requires std::ranges::random_access_range<V> {
+      return *(*this + n);
+    }
+
+    friend constexpr bool operator==(const Iterator& x, const Iterator& y) {
+      return x.last_ == y.last_;
+    }
+    friend constexpr bool operator==(const Iterator& x, std::default_sentinel_t) {
+      return x.last_ == x.end_;
+    }
+    friend constexpr bool operator<(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return x.last_ < y.last_;
+    }
+    friend constexpr bool operator>(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return y < x;
+    }
+    friend constexpr bool operator<=(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return !(y < x);
+    }
+    friend constexpr bool operator>=(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return !(x < y);
+    }
+
+    friend constexpr Iterator operator+(const Iterator& i, difference_type n)
+      requires std::ranges::random_access_range<V> {
+      auto r = i;
+      r += n;
+      return r;
+    }
+    friend constexpr Iterator operator+(difference_type n, const Iterator& i)
+      requires std::ranges::random_access_range<V> {
+      return i + n;
+    }
+    friend constexpr Iterator operator-(const Iterator& i, difference_type n)
+      requires std::ranges::random_access_range<V> {
+      auto r = i;
+      r -= n;
+      return r;
+    }
+    friend constexpr difference_type operator-(const Iterator& x, const Iterator& y)
+      requires std::sized_sentinel_for<VIterT, VIterT> {
+      return x.last_ - y.last_;
+    }
+    friend constexpr difference_type operator-(std::default_sentinel_t, const Iterator& i)
+      requires std::sized_sentinel_for<VSentT, VIterT> {
+      return i.end_ - i.last_;
+    }
+    friend constexpr difference_type operator-(const Iterator& i, std::default_sentinel_t s)
+      requires std::sized_sentinel_for<VSentT, VIterT> {
+      return -(s - i);
+    }
+  };
+
+ private:
+  V base_ = V();
+  std::ranges::range_difference_t<V> n_ = 1;
+
+  template<bool ConstT, typename Self>
+  static constexpr auto beginImpl(Self& self) {
+    if constexpr (ConstT) {
+      auto beg = std::make_const_iterator(std::ranges::begin(self.base_));
+      auto end = std::make_const_sentinel(std::ranges::end(self.base_));
+      auto last = std::ranges::next(beg, self.n_ - 1, end);
+      return Iterator<true>{std::move(beg), std::move(last), std::move(end)};
+    }
+    else {
+      auto beg = std::ranges::begin(self.base_);
+      auto end = std::ranges::end(self.base_);
+      auto last = std::ranges::next(beg, self.n_ - 1, end);
+      return Iterator<false>{std::move(beg), std::move(last), std::move(end)};
+    }
+  }
+  template<bool ConstT, typename Self>
+  static constexpr auto endImpl(Self& self) {
+    using Base = _intern::maybe_const_t<ConstT, V>;
+    if constexpr (std::ranges::random_access_range<Base> && std::ranges::sized_range<Base>
+                  && std::ranges::common_range<Base>) {
+      // O(1) end so that the view is a common range:
+      auto pos = beginImpl<ConstT>(self);
+      pos.current_ += _intern::numWindows(std::ranges::distance(self.base_), self.n_);
+      pos.last_ = pos.end_;
+      return pos;
+    }
+    else {
+      return std::default_sentinel;
+    }
+  }
+
+ public:
+  slide_view() requires std::default_initializable<V> = default;
+
+  constexpr slide_view(V base, std::ranges::range_difference_t<V> n)
+   : base_(std::move(base)), n_{n} {
+      assert(n > 0);
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { return std::move(base_); }
+
+  constexpr auto begin() {
+    return beginImpl<false>(*this);
+  }
+  constexpr auto begin() const requires std::ranges::forward_range<const V> {
+    return beginImpl<true>(*this);
+  }
+
+  constexpr auto end() {
+    return endImpl<false>(*this);
+  }
+  constexpr auto end() const requires std::ranges::forward_range<const V> {
+    return endImpl<true>(*this);
+  }
+
+  // number of windows in O(1):
+  constexpr auto size() requires std::ranges::sized_range<V> {
+    using SizeT = decltype(std::ranges::size(base_));
+    return _intern::numWindows(std::ranges::size(base_), static_cast<SizeT>(n_));
+  }
+  constexpr auto size() const requires std::ranges::sized_range<const V> {
+    using SizeT = decltype(std::ranges::size(base_));
+    return _intern::numWindows(std::ranges::size(base_), static_cast<SizeT>(n_));
+  }
+};
+
+template<typename R>
+slide_view(R&&, std::ranges::range_difference_t<R>) -> slide_view<std::views::all_t<R>>;
+
+} // namespace belleviews
+
+// borrowed if underlying range is borrowed (as with std slide_view):
+template<typename V>
+inline constexpr bool std::ranges::enable_borrowed_range<belleviews::slide_view<V>> = std::ranges::enable_borrowed_range<V>;
+
+
+//*************************************************************
+// belleviews::slide()
+// bel::views::slide()
+//
+// A C++ slide_view adaptor for the belleviews::slide_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename Rg, typename DiffT>
+  concept can_slide_view = requires { slide_view(std::declval<Rg>(), std::declval<DiffT>()); };
+}
+
+struct Slide {
+   // for:  bel::views::slide(rg, 3)
+   template<std::ranges::viewable_range Rg, typename DiffT = std::ranges::range_difference_t<Rg>>
+   requires _intern::can_slide_view<Rg, DiffT>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg, DiffT n) const {
+     return slide_view{std::forward<Rg>(rg), n};
+   }
+
+   // for:  rg | bel::views::slide(3)
+   template<typename T>
+   struct PartialSlide {
+     T n;
+   };
+
+   template<typename DiffT>
+   constexpr auto
+   operator() [[nodiscard]] (DiffT n) const {
+     return PartialSlide<DiffT>{n};
+   }
+
+   template<typename Rg, typename DiffT>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialSlide<DiffT> ps) {
+     return slide_view{std::forward<Rg>(rg), ps.n};
+   }
+};
+
+// belleviews::slide() :
+inline constexpr Slide slide;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::slide() :
+  inline constexpr belleviews::Slide slide;
+}
+
+#endif // BELLESLIDE_HPP
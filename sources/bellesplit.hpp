@@ -0,0 +1,306 @@
+// <bellesplit.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLESPLIT_HPP
+#define BELLESPLIT_HPP
+
+#include <concepts>
+#include <ranges>
+#include <iterator>
+#include <algorithm>
+#include <string>
+#include <string_view>
+#include <cassert>
+
+//*************************************************************
+// class belleviews::split_view
+//
+// A C++ view splitting contiguous character ranges
+// (strings, string_views, vectors of chars, ...)
+// into the substrings between delimiters
+// (e.g., for log lines or CSV rows)
+// with the following benefits compared to C++ standard views
+// - Iterating is stateless
+// - Can iterate over const views
+// - Concurrent iterations are safe
+// - Always propagates const
+// - Yields std::basic_string_view<>s
+// - Delimiters are searched with memchr()
+//   (char_traits<>::find(), which the C library implements with SIMD instructions)
+//   instead of comparing one character after the other
+// Because
+// - This view does not cache anything
+//   (begin() searches the first delimiter, which std::views::split caches)
+// - The iterators only refer to the characters
+//   (so that iterators of the non-const and the const view have the same type)
+// Also:
+// - the delimiter is a single character or a string
+//   (strings are not copied and have to outlive the view, as with string_views)
+// - as with std::views::split, a trailing delimiter yields a trailing empty string
+// OPEN/TODO:
+// - only contiguous sized ranges are supported
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename T>
+  concept char_like = std::same_as<T, char> || std::same_as<T, wchar_t> || std::same_as<T, char8_t>
+                      || std::same_as<T, char16_t> || std::same_as<T, char32_t>;
+
+  // delimiter of split(): a single character or a string view:
+  template<char_like CharT>
+  constexpr CharT splitDelim(CharT c) {
+    return c;
+  }
+  template<char_like CharT>
+  constexpr std::basic_string_view<CharT> splitDelim(const CharT* s) {
+    return s;
+  }
+  template<char_like CharT>
+  constexpr std::basic_string_view<CharT> splitDelim(std::basic_string_view<CharT> s) {
+    return s;
+  }
+  template<char_like CharT, typename Alloc>
+  constexpr std::basic_string_view<CharT> splitDelim(const std::basic_string<CharT, std::char_traits<CharT>, Alloc>& s) {
+    return s;
+  }
+  // the view would refer to a destroyed string:
+  template<char_like CharT, typename Alloc>
+  void splitDelim(std::basic_string<CharT, std::char_traits<CharT>, Alloc>&& s) = delete;
+
+  template<typename V>
+  concept splittable = std::ranges::contiguous_range<V> && std::ranges::sized_range<V>
+                       && char_like<std::ranges::range_value_t<V>>;
+}
+
+template<std::ranges::view V, typename Delim>
+requires _intern::splittable<V>
+         && (std::same_as<Delim, std::ranges::range_value_t<V>>
+             || std::same_as<Delim, std::basic_string_view<std::ranges::range_value_t<V>>>)
+class split_view : public std::ranges::view_interface<split_view<V, Delim>>
+{
+ private:
+  using CharT = std::ranges::range_value_t<V>;
+  using StringView = std::basic_string_view<CharT>;
+
+  // one iterator type for both the non-const and the const view
+  // (it only refers to the characters, which are never modified):
+  class Iterator
+  {
+   public:
+    using iterator_category = std::input_iterator_tag;   // operator* yields prvalues
+    using iterator_concept = std::forward_iterator_tag;
+    using value_type = StringView;
+    using difference_type = std::ptrdiff_t;
+
+   private:
+    friend split_view;
+    StringView text_;
+    Delim delim_ = Delim();
+    std::size_t cur_ = 0;            // begin of the current substring
+    std::size_t next_ = 0;           // end of the current substring (the next delimiter)
+    bool trailingEmpty_ = false;     // yield the empty string after a trailing delimiter
+
+    static constexpr std::size_t shortScan = 16;   // characters compared before calling memchr()
+
+    constexpr Iterator(StringView text, Delim delim, std::size_t cur)
+     : text_{text}, delim_{delim}, cur_{cur}, next_{cur} {
+      if (cur_ != text_.size()) {
+        next_ = findNext(cur_);
+      }
+    }
+
+    constexpr std::size_t delimSize() const noexcept {
+      if constexpr (std::same_as<Delim, CharT>) {
+        return 1;
+      }
+      else {
+        return delim_.size();
+      }
+    }
+    // position of the next delimiter (end if there is none):
+    constexpr std::size_t findNext(std::size_t pos) const noexcept {
+      if constexpr (std::same_as<Delim, CharT>) {
+        // short fields are found faster without calling memchr():
+        auto stop = std::min(text_.size(), pos + shortScan);
+        for ( ; pos != stop; ++pos) {
+          if (text_[pos] == delim_) {
+            return pos;
+          }
+        }
+        if (pos == text_.size()) {
+          return pos;
+        }
+      }
+      // (for single characters find() calls char_traits<>::find(), which is memchr() for char):
+      auto idx = text_.find(delim_, pos);
+      return idx == StringView::npos ? text_.size() : idx;
+    }
+
+   public:
+    Iterator() = default;
+
+    constexpr value_type operator*() const noexcept {
+      return text_.substr(cur_, next_ - cur_);
+    }
+
+    constexpr Iterator& operator++() {
+      cur_ = next_;
+      if (cur_ == text_.size()) {
+        trailingEmpty_ = false;
+      }
+      else {
+        cur_ += delimSize();
+        if (cur_ == text_.size()) {
+          trailingEmpty_ = true;
+          next_ = cur_;
+        }
+        else {
+          next_ = findNext(cur_);
+        }
+      }
+      return *this;
+    }
+    constexpr Iterator operator++(int) {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    friend constexpr bool operator==(const Iterator& x, const Iterator& y) {
+      return x.cur_ == y.cur_ && x.trailingEmpty_ == y.trailingEmpty_;
+    }
+  };
+
+ private:
+  V base_ = V();
+  Delim delim_ = Delim();
+
+  template<typename Base>
+  static constexpr StringView text(Base& base) {
+    return StringView{std::ranges::data(base), std::ranges::size(base)};
+  }
+
+ public:
+  split_view() requires std::default_initializable<V> = default;
+
+  constexpr split_view(V base, Delim delim)
+   : base_(std::move(base)), delim_{delim} {
+    if constexpr (!std::same_as<Delim, CharT>) {
+      assert(!delim_.empty());
+    }
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { return std::move(base_); }
+
+  constexpr Delim delimiter() const { return delim_; }
+
+  constexpr Iterator begin() {
+    return Iterator{text(base_), delim_, 0};
+  }
+  constexpr Iterator begin() const requires _intern::splittable<const V> {
+    return Iterator{text(base_), delim_, 0};
+  }
+
+  constexpr Iterator end() {
+    auto txt = text(base_);
+    return Iterator{txt, delim_, txt.size()};
+  }
+  constexpr Iterator end() const requires _intern::splittable<const V> {
+    auto txt = text(base_);
+    return Iterator{txt, delim_, txt.size()};
+  }
+};
+
+template<typename R, typename Delim>
+split_view(R&&, Delim) -> split_view<std::views::all_t<R>, Delim>;
+
+} // namespace belleviews
+
+// borrowed if underlying range is borrowed:
+template<typename V, typename Delim>
+inline constexpr bool std::ranges::enable_borrowed_range<belleviews::split_view<V, Delim>> = std::ranges::enable_borrowed_range<V>;
+
+
+//*************************************************************
+// belleviews::split()
+// bel::views::split()
+//
+// A C++ split_view adaptor for the belleviews::split_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename D>
+  concept split_delim = requires (D&& d) { _intern::splitDelim(std::forward<D>(d)); };
+
+  template<typename Rg, typename D>
+  concept can_split_view = requires { split_view(std::declval<Rg>(), _intern::splitDelim(std::declval<D>())); };
+}
+
+struct Split {
+   // for:  bel::views::split(rg, ',')
+   template<std::ranges::viewable_range Rg, typename D>
+   requires _intern::can_split_view<Rg, D>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg, D&& delim) const {
+     return split_view{std::forward<Rg>(rg), _intern::splitDelim(std::forward<D>(delim))};
+   }
+
+   // for:  rg | bel::views::split(',')
+   template<typename T>
+   struct PartialSplit {
+     T delim;
+   };
+
+   template<typename D>
+   requires _intern::split_delim<D>
+   constexpr auto
+   operator() [[nodiscard]] (D&& delim) const {
+     using DelimT = decltype(_intern::splitDelim(std::forward<D>(delim)));
+     return PartialSplit<DelimT>{_intern::splitDelim(std::forward<D>(delim))};
+   }
+
+   template<typename Rg, typename DelimT>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialSplit<DelimT> ps) {
+     return split_view{std::forward<Rg>(rg), ps.delim};
+   }
+};
+
+// belleviews::split() :
+inline constexpr Split split;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::split() :
+  inline constexpr belleviews::Split split;
+}
+
+#endif // BELLESPLIT_HPP
@@ -0,0 +1,217 @@
+// <bellestability.hpp> -*- C++ -*-
+//
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+// If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef BELLESTABILITY_HPP
+#define BELLESTABILITY_HPP
+
+#include <concepts>
+#include <ranges>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <atomic>
+
+//*************************************************************
+// struct belleviews::stability_traits<>
+// bel::stability_traits<>
+//
+// Customization point for views caching begin() (eager_begin_view, cache_begin_view)
+// to find out in O(1) whether a cached begin() of a container might no longer be valid:
+// - stable_iterators: whether iterators survive insertions
+//                     (information only: the views check fingerprints anyway,
+//                      because erasing elements still invalidates iterators)
+// - has_fingerprint:  whether fingerprint() is provided
+// - fingerprint(c):   an equality-comparable value that changes
+//                     whenever an iterator of c might be invalidated
+// By default:
+// - contiguous sized ranges (vector, string, small vectors, ...) use data() and size()
+// - other sized ranges with lvalue elements (deque, list, set, map, ...)
+//   use the address of the first element and size()
+//   LIMITATION: modifications that keep the size and the address of the first element
+//   are not detected (e.g., pop_front() and push_front() on a deque when the memory
+//   of the old first element is reused, which might leave a cached begin with a stale node map);
+//   use bel::versioned<> for containers modified this way
+// - node-based containers (list and ordered associative containers)
+//   have stable iterators
+// - bel::versioned<> uses its generation counter (see belleversioned.hpp)
+// Specialize belleviews::stability_traits<> for containers where these defaults
+// are wrong or too expensive.
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+// default fingerprint:
+struct range_fingerprint {
+  const void* first = nullptr;
+  std::size_t size = 0;
+
+  friend bool operator==(const range_fingerprint&, const range_fingerprint&) = default;
+};
+
+namespace _intern {
+  template<typename C>
+  concept node_based = requires (C& c) { c.splice(c.begin(), c); }      // lists
+                       || requires { typename C::node_type;               // set, map, ...
+                                     typename C::key_compare; };
+
+  template<typename C>
+  concept default_fingerprintable = std::ranges::sized_range<const C>
+                                    && std::ranges::forward_range<const C>
+                                    && std::is_lvalue_reference_v<std::ranges::range_reference_t<const C>>;
+}
+
+template<typename C>
+struct stability_traits {
+  static constexpr bool stable_iterators = _intern::node_based<C>;
+  static constexpr bool has_fingerprint = _intern::default_fingerprintable<C>;
+
+  static constexpr range_fingerprint fingerprint(const C& c) requires has_fingerprint {
+    if constexpr (std::ranges::contiguous_range<const C>) {
+      return range_fingerprint{std::ranges::data(c), std::ranges::size(c)};
+    }
+    else {
+      auto size = std::ranges::size(c);
+      return range_fingerprint{size == 0 ? nullptr : std::addressof(*std::ranges::begin(c)),
+                               static_cast<std::size_t>(size)};
+    }
+  }
+};
+
+namespace _intern {
+  // the base of a view
+  // (belle views provide base_ref() to not copy the base (and its predicates) with each check;
+  //  standard views only have base(), which might return a copy):
+  template<typename V>
+  concept has_base_ref = requires (const V& v) { v.base_ref(); };
+
+  constexpr decltype(auto) baseOf(const auto& v) {
+    if constexpr (has_base_ref<std::remove_cvref_t<decltype(v)>>) {
+      return v.base_ref();
+    }
+    else {
+      return v.base();
+    }
+  }
+
+  // the type of the innermost base of a view (following base_ref() or base()):
+  template<typename V>
+  struct InnermostBase {
+    using type = V;
+  };
+  template<typename V>
+  requires requires (const V& v) { v.base_ref(); } || requires (const V& v) { v.base(); }
+  struct InnermostBase<V> {
+    using type = typename InnermostBase<std::remove_cvref_t<decltype(baseOf(std::declval<const V&>()))>>::type;
+  };
+
+  template<typename V>
+  using innermost_base_t = typename InnermostBase<V>::type;
+
+  // the fingerprint of the innermost base of a view
+  // (computed inside the recursion because base() might return temporary copies of inner views):
+  template<typename B>
+  constexpr auto innermostFingerprint(const auto& v) {
+    if constexpr (requires{v.base_ref();} || requires{v.base();}) {
+      return innermostFingerprint<B>(baseOf(v));
+    }
+    else {
+      return stability_traits<B>::fingerprint(v);
+    }
+  }
+
+  // fingerprint of the innermost base of a view
+  // (empty if the innermost base has no fingerprint):
+  struct NoFingerprint {
+    friend bool operator==(const NoFingerprint&, const NoFingerprint&) = default;
+  };
+
+  template<typename B, bool = stability_traits<B>::has_fingerprint>
+  struct FingerprintType {
+    using type = decltype(stability_traits<B>::fingerprint(std::declval<const B&>()));
+  };
+
+  template<typename B>
+  struct FingerprintType<B, false> {
+    using type = NoFingerprint;
+  };
+
+  template<typename V>
+  struct BeginFingerprint {
+    using Base = innermost_base_t<V>;
+    static constexpr bool enabled = stability_traits<Base>::has_fingerprint;
+    using type = typename FingerprintType<Base>::type;
+
+    static constexpr type of(const V& v) {
+      if constexpr (enabled) {
+        return innermostFingerprint<Base>(v);
+      }
+      else {
+        return NoFingerprint{};
+      }
+    }
+  };
+}
+
+} // namespace belleviews
+
+
+//*************************************************************
+// stale begin handler
+// - called when a view caching begin() (eager_begin_view, cache_begin_view)
+//   detects that its cached begin() is no longer valid (the begin is recomputed anyway)
+// - default: nullptr (silently recompute)
+// - set_stale_begin_handler() returns the previous handler
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+using stale_begin_handler = void (*)(const char* msg);
+
+namespace _intern {
+  inline std::atomic<stale_begin_handler> staleBeginHandler{nullptr};
+
+  inline void reportStaleBegin(const char* msg) {
+    if (auto handler = staleBeginHandler.load(std::memory_order_relaxed)) {
+      handler(msg);
+    }
+  }
+}
+
+inline stale_begin_handler set_stale_begin_handler(stale_begin_handler handler) noexcept {
+  return _intern::staleBeginHandler.exchange(handler);
+}
+
+inline stale_begin_handler get_stale_begin_handler() noexcept {
+  return _intern::staleBeginHandler.load();
+}
+
+} // namespace belleviews
+
+
+BELLEVIEWS_EXPORT namespace bel {
+  // bel::stability_traits<> :
+  template<typename C>
+  using stability_traits = belleviews::stability_traits<C>;
+}
+
+#endif // BELLESTABILITY_HPP
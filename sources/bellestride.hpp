@@ -0,0 +1,410 @@
+// <bellestride.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLESTRIDE_HPP
+#define BELLESTRIDE_HPP
+
+#include <concepts>
+#include <ranges>
+#include <iterator>
+#include <memory>
+#include <cstddef>
+#include <cassert>
+
+//*************************************************************
+// class belleviews::strided_span
+// bel::strided_span
+//
+// Every stride-th element of contiguous memory
+// - provided by stride_view::strided() for contiguous ranges
+//   as hook for gathering kernels (e.g. SIMD gather instructions):
+//     for (std::size_t i = 0; i < s.size; ++i) { ... s.data[i * s.stride] ... }
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<typename T>
+struct strided_span
+{
+  T* data = nullptr;
+  std::ptrdiff_t stride = 1;
+  std::size_t size = 0;
+
+  constexpr T& operator[](std::size_t idx) const {
+    return data[static_cast<std::ptrdiff_t>(idx) * stride];
+  }
+};
+
+} // namespace belleviews
+
+
+//*************************************************************
+// class belleviews::stride_view
+//
+// A C++ view yielding every n-th element
+// with the following benefits compared to C++ standard views
+// - Iterating is stateless
+// - Can iterate over const views
+// - Concurrent iterations are safe
+// - Always propagates const
+// Because
+// - This view does not cache anything
+// - This view yields const iterators when it is const
+// Also:
+// - keeps random access and size() of random-access/sized ranges
+//   (incrementing is a single add)
+// - strided() provides a strided_span<> for contiguous ranges
+// OPEN/TODO:
+// - input ranges are not supported yet
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<std::ranges::view V>
+requires std::ranges::forward_range<V>
+class stride_view : public std::ranges::view_interface<stride_view<V>>
+{
+ private:
+  // one iterator type for both the non-const and the const view
+  // (the const one iterates with const iterators of the underlying const view):
+  template<bool ConstT>
+  using VIter = typename _intern::MaybeConstIterators<ConstT, V>::iterator;
+  template<bool ConstT>
+  using VSent = typename _intern::MaybeConstIterators<ConstT, V>::sentinel;
+
+  template<bool ConstT>
+  class Iterator
+  {
+   private:
+    using VIterT = VIter<ConstT>;
+    using VSentT = VSent<ConstT>;
+
+    static constexpr auto _s_iter_concept() {
+      if constexpr (std::ranges::random_access_range<V>)
+        return std::random_access_iterator_tag{};
+      else if constexpr (std::ranges::bidirectional_range<V>)
+        return std::bidirectional_iterator_tag{};
+      else
+        return std::forward_iterator_tag{};
+    }
+    static auto _s_iter_cat() {
+      using Cat = typename std::iterator_traits<VIterT>::iterator_category;
+      if constexpr (std::derived_from<Cat, std::random_access_iterator_tag>)
+        return std::random_access_iterator_tag{};
+      else
+        return Cat{};
+    }
+
+   public:
+    using iterator_concept = decltype(_s_iter_concept());
+    using iterator_category = decltype(_s_iter_cat());
+    using value_type = std::ranges::range_value_t<V>;
+    using difference_type = std::ranges::range_difference_t<V>;
+
+   private:
+    friend stride_view;
+    VIterT current_ = VIterT();
+    VSentT end_ = VSentT();
+    difference_type stride_ = 0;
+    difference_type missing_ = 0;   // steps missing in the last stride after end is reached
+
+    constexpr Iterator(VIterT cur, VSentT end, difference_type stride, difference_type missing = 0)
+     : current_{std::move(cur)}, end_{std::move(end)}, stride_{stride}, missing_{missing} {
+    }
+
+   public:
+    Iterator() = default;
+
+    constexpr Iterator(Iterator<!ConstT> i)
+      requires ConstT && std::convertible_to<VIter<false>, VIterT>
+                      && std::convertible_to<VSent<false>, VSentT>
+     : current_{std::move(i.current_)}, end_{std::move(i.end_)}, stride_{i.stride_}, missing_{i.missing_} {
+    }
+
+    constexpr const VIterT& base() const& noexcept {
+      return current_;
+    }
+    constexpr VIterT base() && {
+      return std::move(current_);
+    }
+
+    constexpr std::iter_reference_t<VIterT> operator*() const {
+      return *current_;
+    }
+
+    constexpr Iterator& operator++() {
+      assert(current_ != end_);
+      missing_ = std::ranges::advance(current_, stride_, end_);
+      return *this;
+    }
+    constexpr Iterator operator++(int) {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    constexpr Iterator& operator--() requires std::ranges::bidirectional_range<V> {
+      std::ranges::advance(current_, missing_ - stride_);
+      missing_ = 0;
+      return *this;
+    }
+    constexpr Iterator operator--(int) requires std::ranges::bidirectional_range<V> {
+      auto tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    constexpr Iterator& operator+=(difference_type n) requires std::ranges::random_access_range<V> {
+      if (n > 0) {
+        missing_ = std::ranges::advance(current_, stride_ * n, end_);
+      }
+      else if (n < 0) {
+        std::ranges::advance(current_, stride_ * n + missing_);
+        missing_ = 0;
+      }
+      return *this;
+    }
+    constexpr Iterator& operator-=(difference_type n) requires std::ranges::random_access_range<V> {
+      return *this += -n;
+    }
+    constexpr std::iter_reference_t<VIterT> operator[](difference_type n) const
+      requires std::ranges::random_access_range<V> {
+      return *(*this + n);
+    }
+
+    friend constexpr bool operator==(const Iterator& x, const Iterator& y) {
+      return x.current_ == y.current_;
+    }
+    friend constexpr bool operator==(const Iterator& x, std::default_sentinel_t) {
+      return x.current_ == x.end_;
+    }
+    friend constexpr auto operator<=>(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> && std::three_way_comparable<VIterT> {
+      return x.current_ <=> y.current_;
+    }
+    friend constexpr bool operator<(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return x.current_ < y.current_;
+    }
+    friend constexpr bool operator>(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return y < x;
+    }
+    friend constexpr bool operator<=(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return !(y < x);
+    }
+    friend constexpr bool operator>=(const Iterator& x, const Iterator& y)
+      requires std::ranges::random_access_range<V> {
+      return !(x < y);
+    }
+
+    friend constexpr Iterator operator+(const Iterator& i, difference_type n)
+      requires std::ranges::random_access_range<V> {
+      auto r = i;
+      r += n;
+      return r;
+    }
+    friend constexpr Iterator operator+(difference_type n, const Iterator& i)
+      requires std::ranges::random_access_range<V> {
+      return i + n;
+    }
+    friend constexpr Iterator operator-(const Iterator& i, difference_type n)
+      requires std::ranges::random_access_range<V> {
+      auto r = i;
+      r -= n;
+      return r;
+    }
+    friend constexpr difference_type operator-(const Iterator& x, const Iterator& y)
+      requires std::sized_sentinel_for<VIterT, VIterT> {
+      return (x.current_ - y.current_ + x.missing_ - y.missing_) / x.stride_;
+    }
+    friend constexpr difference_type operator-(std::default_sentinel_t, const Iterator& i)
+      requires std::sized_sentinel_for<VSentT, VIterT> {
+      return _intern::divCeil(difference_type(i.end_ - i.current_), i.stride_);
+    }
+    friend constexpr difference_type operator-(const Iterator& i, std::default_sentinel_t s)
+      requires std::sized_sentinel_for<VSentT, VIterT> {
+      return -(s - i);
+    }
+
+    friend constexpr std::iter_rvalue_reference_t<VIterT> iter_move(const Iterator& i)
+      noexcept(noexcept(std::ranges::iter_move(i.current_))) {
+      return std::ranges::iter_move(i.current_);
+    }
+  };
+
+ private:
+  V base_ = V();
+  std::ranges::range_difference_t<V> stride_ = 1;
+
+  template<bool ConstT, typename Self>
+  static constexpr auto beginImpl(Self& self) {
+    if constexpr (ConstT) {
+      return Iterator<true>{std::make_const_iterator(std::ranges::begin(self.base_)),
+                            std::make_const_sentinel(std::ranges::end(self.base_)),
+                            self.stride_};
+    }
+    else {
+      return Iterator<false>{std::ranges::begin(self.base_), std::ranges::end(self.base_), self.stride_};
+    }
+  }
+  template<bool ConstT, typename Self>
+  static constexpr auto endImpl(Self& self) {
+    using Base = _intern::maybe_const_t<ConstT, V>;
+    if constexpr (std::ranges::common_range<Base> && std::ranges::sized_range<Base>) {
+      auto missing = (self.stride_ - std::ranges::distance(self.base_) % self.stride_) % self.stride_;
+      auto pos = beginImpl<ConstT>(self);
+      pos.current_ = pos.end_;
+      pos.missing_ = missing;
+      return pos;
+    }
+    else if constexpr (std::ranges::common_range<Base> && !std::ranges::bidirectional_range<Base>) {
+      auto pos = beginImpl<ConstT>(self);
+      pos.current_ = pos.end_;
+      return pos;
+    }
+    else {
+      return std::default_sentinel;
+    }
+  }
+
+ public:
+  stride_view() requires std::default_initializable<V> = default;
+
+  constexpr stride_view(V base, std::ranges::range_difference_t<V> stride)
+   : base_(std::move(base)), stride_{stride} {
+      assert(stride > 0);
+  }
+
+  constexpr V base() const& requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
+  constexpr V base() && { return std::move(base_); }
+
+  constexpr auto stride() const noexcept {
+    return stride_;
+  }
+
+  constexpr auto begin() {
+    return beginImpl<false>(*this);
+  }
+  constexpr auto begin() const requires std::ranges::forward_range<const V> {
+    return beginImpl<true>(*this);
+  }
+
+  constexpr auto end() {
+    return endImpl<false>(*this);
+  }
+  constexpr auto end() const requires std::ranges::forward_range<const V> {
+    return endImpl<true>(*this);
+  }
+
+  constexpr auto size() requires std::ranges::sized_range<V> {
+    using SizeT = decltype(std::ranges::size(base_));
+    return _intern::divCeil(std::ranges::size(base_), static_cast<SizeT>(stride_));
+  }
+  constexpr auto size() const requires std::ranges::sized_range<const V> {
+    using SizeT = decltype(std::ranges::size(base_));
+    return _intern::divCeil(std::ranges::size(base_), static_cast<SizeT>(stride_));
+  }
+
+  // gather hook for contiguous ranges
+  // (a strided_span of const elements if the view is const):
+  constexpr auto strided() requires std::ranges::contiguous_range<V> && std::ranges::sized_range<V> {
+    using T = std::remove_reference_t<std::ranges::range_reference_t<V>>;
+    return strided_span<T>{std::ranges::data(base_), stride_, static_cast<std::size_t>(size())};
+  }
+  constexpr auto strided() const requires std::ranges::contiguous_range<const V> && std::ranges::sized_range<const V> {
+    using T = const std::remove_reference_t<std::ranges::range_reference_t<const V>>;
+    return strided_span<T>{std::ranges::data(base_), stride_, static_cast<std::size_t>(size())};
+  }
+};
+
+template<typename R>
+stride_view(R&&, std::ranges::range_difference_t<R>) -> stride_view<std::views::all_t<R>>;
+
+} // namespace belleviews
+
+// borrowed if underlying range is borrowed (as with std stride_view):
+template<typename V>
+inline constexpr bool std::ranges::enable_borrowed_range<belleviews::stride_view<V>> = std::ranges::enable_borrowed_range<V>;
+
+
+//*************************************************************
+// belleviews::stride()
+// bel::views::stride()
+//
+// A C++ stride_view adaptor for the belleviews::stride_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename Rg, typename DiffT>
+  concept can_stride_view = requires { stride_view(std::declval<Rg>(), std::declval<DiffT>()); };
+}
+
+struct Stride {
+   // for:  bel::views::stride(rg, 2)
+   template<std::ranges::viewable_range Rg, typename DiffT = std::ranges::range_difference_t<Rg>>
+   requires _intern::can_stride_view<Rg, DiffT>
+   constexpr auto
+   operator() [[nodiscard]] (Rg&& rg, DiffT n) const {
+     return stride_view{std::forward<Rg>(rg), n};
+   }
+
+   // for:  rg | bel::views::stride(2)
+   template<typename T>
+   struct PartialStride {
+     T n;
+   };
+
+   template<typename DiffT>
+   constexpr auto
+   operator() [[nodiscard]] (DiffT n) const {
+     return PartialStride<DiffT>{n};
+   }
+
+   template<typename Rg, typename DiffT>
+   friend constexpr auto
+   operator| (Rg&& rg, PartialStride<DiffT> ps) {
+     return stride_view{std::forward<Rg>(rg), ps.n};
+   }
+};
+
+// belleviews::stride() :
+inline constexpr Stride stride;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::stride() :
+  inline constexpr belleviews::Stride stride;
+}
+
+BELLEVIEWS_EXPORT namespace bel {
+  // bel::strided_span<> :
+  template<typename T>
+  using strided_span = belleviews::strided_span<T>;
+}
+
+#endif // BELLESTRIDE_HPP
@@ -46,7 +46,7 @@
 // - propgates const
 // - borrowed?
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 enum class subrange_kind : bool { unsized, sized };
 
@@ -283,7 +283,7 @@ inline constexpr bool std::ranges::enable_borrowed_range<belleviews::sub_view<It
 // 
 // A C++ sub_view factory for the belleviews::sub_view
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 namespace _intern {
   template<typename It, typename Sent>
@@ -306,14 +306,14 @@ inline constexpr Sub sub;
 } // namespace belleviews
 
 
-namespace bel::views {
+BELLEVIEWS_EXPORT namespace bel::views {
   // bel::views::sub() :
   inline constexpr belleviews::Sub sub;
 }
 
 
 // allows to use bel::subrange instead of belleviews::sub_view
-namespace bel {
+BELLEVIEWS_EXPORT namespace bel {
   template<std::input_or_output_iterator It, std::sentinel_for<It> Sent = It,
            belleviews::subrange_kind Kind = std::sized_sentinel_for<Sent, It>
                                               ? belleviews::subrange_kind::sized
@@ -44,7 +44,7 @@
 // OPEN/TODO:
 // - ...
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 template<std::ranges::view V>
 class take_view : public std::ranges::view_interface<take_view<V>>
@@ -96,6 +96,7 @@ class take_view : public std::ranges::view_interface<take_view<V>>
   }
 
   constexpr V base() const & requires std::copy_constructible<V> { return base_; }
+  constexpr const V& base_ref() const& noexcept { return base_; }
   constexpr V base() && { return std::move(base_); }
 
   // begin() for non-simple views (already in the standard):
@@ -116,8 +117,9 @@ class take_view : public std::ranges::view_interface<take_view<V>>
   }
   // begin() const for const-iterable views (already in the standard)
   // is splitted:
-  // - the non-const version returns non-const iterators:
-  constexpr auto begin() requires std::ranges::range<const V> {
+  // - the non-const version returns non-const iterators
+  //   (non-simple views use the version above):
+  constexpr auto begin() requires _intern::simple_view<V> {
     //std::cout << "take_view::begin() for simple views\n";
     if constexpr (std::ranges::sized_range<const V>) {
       if constexpr (std::ranges::random_access_range<const V>) {
@@ -152,8 +154,7 @@ class take_view : public std::ranges::view_interface<take_view<V>>
     }
   }
 
-  // end(): no change (yet)
-  // - TODO: how to deal with sentinels in the const case?
+  // end() for non-simple views (already in the standard):
   constexpr auto end() requires (!_intern::simple_view<V>) {
     if constexpr (std::ranges::sized_range<V>) {
       if constexpr (std::ranges::random_access_range<V>) {
@@ -168,6 +169,24 @@ class take_view : public std::ranges::view_interface<take_view<V>>
       return Sentinel<false>{std::ranges::end(base_)};
     }
   }
+  // end() const for const-iterable views (already in the standard)
+  // is splitted as begin():
+  // - the non-const version returns non-const iterators
+  //   (non-simple views use the version above):
+  constexpr auto end() requires _intern::simple_view<V> {
+    if constexpr (std::ranges::sized_range<const V>) {
+      if constexpr (std::ranges::random_access_range<const V>) {
+        return std::ranges::begin(base_) + std::ranges::range_difference_t<const V>(size());
+      }
+      else {
+        return std::default_sentinel;
+      }
+    }
+    else {
+      return Sentinel<false>{std::ranges::end(base_)};
+    }
+  }
+  // - the const version returns const iterators:
   constexpr auto end() const requires std::ranges::range<const V> {
     if constexpr (std::ranges::sized_range<const V>) {
       if constexpr (std::ranges::random_access_range<const V>) {
@@ -209,7 +228,7 @@ inline constexpr bool std::ranges::enable_borrowed_range<belleviews::take_view<V
 // 
 // A C++ take_view adaptor for the belleviews::take_view
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 namespace _intern {
   template<typename Rg, typename DiffT>
@@ -249,7 +268,7 @@ inline constexpr Take take;
 
 } // namespace belleviews
 
-namespace bel::views {
+BELLEVIEWS_EXPORT namespace bel::views {
   // bel::views::take() :
   inline constexpr belleviews::Take take;
 }
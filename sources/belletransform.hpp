@@ -44,7 +44,7 @@
 // - propgates const
 // - borrowed?
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 template<std::ranges::input_range V, std::copy_constructible F>
 requires std::ranges::view<V> && std::is_object_v<F>
@@ -344,6 +344,7 @@ class transform_view : public std::ranges::view_interface<transform_view<V, F>>
   }
 
   constexpr V base() const& requires std::copy_constructible<V> { return _m_base ; }
+  constexpr const V& base_ref() const& noexcept { return _m_base; }
   constexpr V base() && { return std::move(_m_base); }
 
   constexpr Iterator<false> begin() {
@@ -400,7 +401,7 @@ transform_view(R&&, F) -> transform_view<std::views::all_t<R>, F>;
 // 
 // A C++ transform_view adaptor for the belleviews::transform_view
 //*************************************************************
-namespace belleviews {
+BELLEVIEWS_EXPORT namespace belleviews {
 
 namespace _intern {
   template<typename Rg, typename Func>
@@ -440,7 +441,7 @@ inline constexpr Transform transform;
 
 } // namespace belleviews
 
-namespace bel::views {
+BELLEVIEWS_EXPORT namespace bel::views {
   // bel::views::transform() :
   inline constexpr belleviews::Transform transform;
 }
@@ -0,0 +1,224 @@
+// <belleversioned.hpp> -*- C++ -*-
+//
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+// If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef BELLEVERSIONED_HPP
+#define BELLEVERSIONED_HPP
+
+#include <concepts>
+#include <ranges>
+#include <cstddef>
+#include <initializer_list>
+#include <utility>
+#include "bellestability.hpp"
+
+//*************************************************************
+// class belleviews::versioned<>
+// bel::versioned<>
+//
+// A container wrapper with a generation counter
+// - all modifications that might invalidate iterators
+//   (insert, erase, resize, assignment, ...) increment the generation
+// - modifying the values of the elements (via operator[], iterators, ...)
+//   does not increment the generation
+// - views caching begin() (such as eager_begin_view) can check in O(1)
+//   whether the cached begin is still valid (see stability_traits<>)
+// For modifications not provided here, use modify():
+//   coll.modify([](auto& c) { c.shrink_to_fit(); });
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<std::ranges::range C>
+class versioned
+{
+ private:
+  C coll_ = C();
+  std::size_t generation_ = 0;
+
+ public:
+  using container_type = C;
+  using value_type = std::ranges::range_value_t<C>;
+  using size_type = std::ranges::range_size_t<C>;
+  using iterator = std::ranges::iterator_t<C>;
+  using const_iterator = std::ranges::iterator_t<const C>;
+
+  versioned() requires std::default_initializable<C> = default;
+
+  constexpr explicit versioned(C coll)
+   : coll_(std::move(coll)) {
+  }
+  constexpr versioned(std::initializer_list<value_type> il)
+  requires std::constructible_from<C, std::initializer_list<value_type>>
+   : coll_(il) {
+  }
+
+  // assigning the whole container is a new generation:
+  constexpr versioned(const versioned&) = default;
+  constexpr versioned(versioned&&) = default;
+  constexpr versioned& operator=(const versioned& rhs) {
+    coll_ = rhs.coll_;
+    ++generation_;
+    return *this;
+  }
+  constexpr versioned& operator=(versioned&& rhs) {
+    coll_ = std::move(rhs.coll_);
+    ++rhs.generation_;
+    ++generation_;
+    return *this;
+  }
+
+  constexpr std::size_t generation() const noexcept { return generation_; }
+
+  // read access to the wrapped container:
+  constexpr const C& get() const noexcept { return coll_; }
+
+  // any modification of the wrapped container:
+  template<std::invocable<C&> F>
+  constexpr decltype(auto) modify(F&& f) {
+    ++generation_;
+    return std::forward<F>(f)(coll_);
+  }
+
+  // range access (without modifying the generation):
+  constexpr auto begin() { return std::ranges::begin(coll_); }
+  constexpr auto end() { return std::ranges::end(coll_); }
+  constexpr auto begin() const { return std::ranges::begin(coll_); }
+  constexpr auto end() const { return std::ranges::end(coll_); }
+
+  constexpr auto size() const requires std::ranges::sized_range<const C> {
+    return std::ranges::size(coll_);
+  }
+  constexpr bool empty() const {
+    return std::ranges::empty(coll_);
+  }
+  constexpr auto data() requires std::ranges::contiguous_range<C> {
+    return std::ranges::data(coll_);
+  }
+  constexpr auto data() const requires std::ranges::contiguous_range<const C> {
+    return std::ranges::data(coll_);
+  }
+  constexpr decltype(auto) operator[](size_type idx) requires requires (C& c) { c[idx]; } {
+    return coll_[idx];
+  }
+  constexpr decltype(auto) operator[](size_type idx) const requires requires (const C& c) { c[idx]; } {
+    return coll_[idx];
+  }
+
+  // modifications that might invalidate iterators:
+  template<typename... Args>
+  requires requires (C& c, Args&&... args) { c.push_back(std::forward<Args>(args)...); }
+  constexpr void push_back(Args&&... args) {
+    ++generation_;
+    coll_.push_back(std::forward<Args>(args)...);
+  }
+  template<typename... Args>
+  requires requires (C& c, Args&&... args) { c.emplace_back(std::forward<Args>(args)...); }
+  constexpr decltype(auto) emplace_back(Args&&... args) {
+    ++generation_;
+    return coll_.emplace_back(std::forward<Args>(args)...);
+  }
+  template<typename... Args>
+  requires requires (C& c, Args&&... args) { c.push_front(std::forward<Args>(args)...); }
+  constexpr void push_front(Args&&... args) {
+    ++generation_;
+    coll_.push_front(std::forward<Args>(args)...);
+  }
+  template<typename... Args>
+  requires requires (C& c, Args&&... args) { c.emplace_front(std::forward<Args>(args)...); }
+  constexpr decltype(auto) emplace_front(Args&&... args) {
+    ++generation_;
+    return coll_.emplace_front(std::forward<Args>(args)...);
+  }
+  template<typename... Args>
+  requires requires (C& c, Args&&... args) { c.insert(std::forward<Args>(args)...); }
+  constexpr decltype(auto) insert(Args&&... args) {
+    ++generation_;
+    return coll_.insert(std::forward<Args>(args)...);
+  }
+  template<typename... Args>
+  requires requires (C& c, Args&&... args) { c.emplace(std::forward<Args>(args)...); }
+  constexpr decltype(auto) emplace(Args&&... args) {
+    ++generation_;
+    return coll_.emplace(std::forward<Args>(args)...);
+  }
+  template<typename... Args>
+  requires requires (C& c, Args&&... args) { c.erase(std::forward<Args>(args)...); }
+  constexpr decltype(auto) erase(Args&&... args) {
+    ++generation_;
+    return coll_.erase(std::forward<Args>(args)...);
+  }
+  template<typename... Args>
+  requires requires (C& c, Args&&... args) { c.assign(std::forward<Args>(args)...); }
+  constexpr void assign(Args&&... args) {
+    ++generation_;
+    coll_.assign(std::forward<Args>(args)...);
+  }
+  template<typename... Args>
+  requires requires (C& c, Args&&... args) { c.resize(std::forward<Args>(args)...); }
+  constexpr void resize(Args&&... args) {
+    ++generation_;
+    coll_.resize(std::forward<Args>(args)...);
+  }
+  constexpr void reserve(size_type n) requires requires (C& c) { c.reserve(n); } {
+    ++generation_;
+    coll_.reserve(n);
+  }
+  constexpr void pop_back() requires requires (C& c) { c.pop_back(); } {
+    ++generation_;
+    coll_.pop_back();
+  }
+  constexpr void pop_front() requires requires (C& c) { c.pop_front(); } {
+    ++generation_;
+    coll_.pop_front();
+  }
+  constexpr void clear() requires requires (C& c) { c.clear(); } {
+    ++generation_;
+    coll_.clear();
+  }
+};
+
+template<std::ranges::range C>
+versioned(C) -> versioned<C>;
+
+// the generation is the fingerprint of versioned containers:
+template<typename C>
+struct stability_traits<versioned<C>> {
+  static constexpr bool stable_iterators = stability_traits<C>::stable_iterators;
+  static constexpr bool has_fingerprint = true;
+
+  static constexpr std::size_t fingerprint(const versioned<C>& c) noexcept {
+    return c.generation();
+  }
+};
+
+} // namespace belleviews
+
+
+BELLEVIEWS_EXPORT namespace bel {
+  // bel::versioned<> :
+  template<std::ranges::range C>
+  using versioned = belleviews::versioned<C>;
+}
+
+#endif // BELLEVERSIONED_HPP
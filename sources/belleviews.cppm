@@ -0,0 +1,69 @@
+// <belleviews.cppm> -*- C++ -*-
+//
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+// If not, see <http://www.gnu.org/licenses/>.
+
+
+//**********************************************************************
+// C++20 module belleviews
+// - exports all views declared in the headers (including belletransform.hpp)
+// - compile with:
+//     g++ --std=c++20 -fmodules-ts -xc++ -c belleviews.cppm
+//     clang++ --std=c++20 --precompile -xc++-module belleviews.cppm -o belleviews.pcm
+// - header fallback: programs can always #include "belleviews.hpp";
+//   with -DBELLEVIEWS_USE_MODULE that header imports this module instead
+//**********************************************************************
+
+module;
+
+// all standard headers the views use have to be in the global module fragment:
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+export module belleviews;
+
+#define BELLEVIEWS_EXPORT export
+#include "belleviews.hpp"
+#include "belletransform.hpp"
@@ -54,6 +54,72 @@
 #ifndef BELLEVIEWS_HPP
 #define BELLEVIEWS_HPP
 
+#if defined(BELLEVIEWS_USE_MODULE) && !defined(BELLEVIEWS_EXPORT)
+
+//**********************************************************************
+// Import C++20 module belleviews (see belleviews.cppm) instead of the headers
+// - macros are not exported, so we provide the standard headers the views use
+// - the headers are part of the module, so further includes of them are no-ops
+//**********************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+import belleviews;
+
+#define BELLEVIEWSUTILS_HPP
+#define MAKECONSTITERATOR_HPP
+#define BELLETAKE_HPP
+#define BELLEDROP_HPP
+#define BELLEDROPWHILE_HPP
+#define BELLEFILTER_HPP
+#define BELLESUB_HPP
+#define BELLEALL_HPP
+#define BELLESTABILITY_HPP
+#define BELLEVERSIONED_HPP
+#define BELLEEAGERBEGIN_HPP
+#define BELLECACHEBEGIN_HPP
+#define BELLEMATERIALIZE_HPP
+#define BELLECACHELATEST_HPP
+#define BELLEANYVIEW_HPP
+#define BELLECHUNK_HPP
+#define BELLESTRIDE_HPP
+#define BELLEZIP_HPP
+#define BELLEENUMERATE_HPP
+#define BELLEJOIN_HPP
+#define BELLECONCAT_HPP
+#define BELLEREVERSE_HPP
+#define BELLEELEMENTS_HPP
+#define BELLESLIDE_HPP
+#define BELLEROLLING_HPP
+#define BELLESPLIT_HPP
+#define BELLESEGMENTED_HPP
+#define BELLETRANSFORM_HPP
+
+#else
+
 //**********************************************************************
 // General utilities
 //**********************************************************************
@@ -74,6 +140,26 @@
 #endif
 #include "bellesub.hpp"
 #include "belleall.hpp"
+#include "bellestability.hpp"
+#include "belleversioned.hpp"
 #include "belleeagerbegin.hpp"
+#include "bellecachebegin.hpp"
+#include "bellematerialize.hpp"
+#include "bellecachelatest.hpp"
+#include "belleanyview.hpp"
+#include "bellechunk.hpp"
+#include "bellestride.hpp"
+#include "bellezip.hpp"
+#include "belleenumerate.hpp"
+#include "bellejoin.hpp"
+#include "belleconcat.hpp"
+#include "bellereverse.hpp"
+#include "belleelements.hpp"
+#include "belleslide.hpp"
+#include "bellerolling.hpp"
+#include "bellesplit.hpp"
+#include "bellesegmented.hpp"
+
+#endif // BELLEVIEWS_USE_MODULE
 
 #endif // BELLEVIEWS_HPP
@@ -29,6 +29,17 @@
 #define BELLEVIEWSUTILS_HPP
 
 #include <optional>
+#include <memory>
+
+//**********************************************************************
+// BELLEVIEWS_EXPORT
+// - marks all public declarations of the views
+// - expands to export when the headers are compiled as C++20 module belleviews
+//   (see belleviews.cppm), otherwise to nothing
+//**********************************************************************
+#ifndef BELLEVIEWS_EXPORT
+#define BELLEVIEWS_EXPORT
+#endif
 
 //**********************************************************************
 // General utilities
@@ -83,6 +94,22 @@ namespace belleviews::_intern {
   template<bool ConstT, typename T>
     using maybe_const_t = std::conditional_t<ConstT, const T, T>;
 
+  // divCeil (number of chunks/strides for num elements):
+  template<typename T>
+  constexpr T divCeil(T num, T denom) {
+    T r = num / denom;
+    if (num % denom) {
+      ++r;
+    }
+    return r;
+  }
+
+  // numWindows (number of sliding windows of w elements for num elements):
+  template<typename T>
+  constexpr T numWindows(T num, T w) {
+    return num < w ? T(0) : num - w + 1;
+  }
+
   // can_reference:
   template<typename T>
     using with_ref = T&;
@@ -148,7 +175,73 @@ namespace belleviews::_intern {
       return *this;
     }
   };
-  // TODO: optimize SemiregBox as in gcc (__box there)
+
+  // SemiregBox optimized as in gcc (__box there):
+  // - for types that are copyable or nothrow copy and move constructible
+  //   we need no std::optional<> (and therefore no engaged flag):
+  //   - assignment (if not available) is done via destruction and copy/move construction
+  //   - empty types (e.g., lambdas without captures) have size 0 with [[no_unique_address]]
+  template<boxable V>
+  requires std::copyable<V> || (std::is_nothrow_copy_constructible_v<V>
+                                && std::is_nothrow_move_constructible_v<V>)
+  struct SemiregBox<V>
+  {
+   private:
+    [[no_unique_address]] V value_ = V();
+
+   public:
+    SemiregBox() requires std::default_initializable<V> = default;
+
+    constexpr explicit SemiregBox(const V& v) noexcept(std::is_nothrow_copy_constructible_v<V>)
+     : value_(v) {
+    }
+    constexpr explicit SemiregBox(V&& v) noexcept(std::is_nothrow_move_constructible_v<V>)
+     : value_(std::move(v)) {
+    }
+
+    template<typename... Args>
+    requires std::constructible_from<V, Args...>
+    constexpr explicit SemiregBox(std::in_place_t, Args&&... args)
+    noexcept(std::is_nothrow_constructible_v<V, Args...>)
+     : value_(std::forward<Args>(args)...) {
+    }
+
+    SemiregBox(const SemiregBox&) = default;
+    SemiregBox(SemiregBox&&) = default;
+    SemiregBox& operator=(const SemiregBox&) requires std::copyable<V> = default;
+    SemiregBox& operator=(SemiregBox&&) requires std::copyable<V> = default;
+
+    // if not copyable, assign by destruction and (nothrow) construction:
+    constexpr SemiregBox& operator=(const SemiregBox& rhs) noexcept
+    requires (!std::copyable<V>) {
+      if (this != std::addressof(rhs)) {
+        value_.~V();
+        std::construct_at(std::addressof(value_), *rhs);
+      }
+      return *this;
+    }
+
+    constexpr SemiregBox& operator=(SemiregBox&& rhs) noexcept
+    requires (!std::copyable<V>) {
+      if (this != std::addressof(rhs)) {
+        value_.~V();
+        std::construct_at(std::addressof(value_), std::move(*rhs));
+      }
+      return *this;
+    }
+
+    constexpr bool has_value() const noexcept {
+      return true;
+    }
+
+    constexpr V& operator*() & noexcept { return value_; }
+    constexpr const V& operator*() const& noexcept { return value_; }
+    constexpr V&& operator*() && noexcept { return std::move(value_); }
+    constexpr const V&& operator*() const&& noexcept { return std::move(value_); }
+
+    constexpr V* operator->() noexcept { return std::addressof(value_); }
+    constexpr const V* operator->() const noexcept { return std::addressof(value_); }
+  };
 
   // convertible_to_non_slicing
   template<typename From, typename To>
@@ -223,20 +316,38 @@ namespace belleviews::_intern {
 
 #include "makeconstiterator.hpp"
 
-namespace std {
+BELLEVIEWS_EXPORT namespace std {
+// never wrap iterators that are already constant (see makeconstiterator.hpp):
 template<std::input_iterator I>
-constexpr auto make_const_iterator(I it)
+constexpr belleviews::_intern::const_iterator<I> make_const_iterator(I it)
 {
-  return belleviews::_intern::make_const_iterator(it);
+  return it;
 }
 
 template<typename S>
-constexpr auto make_const_sentinel(S s)
+constexpr belleviews::_intern::const_sentinel<S> make_const_sentinel(S s)
 {
-  return belleviews::_intern::make_const_sentinel(s);
+  return s;
 }
 }// namespace std
 
 #endif // __cpp_lib_ranges_as_const
 
+namespace belleviews::_intern {
+  // iterator and sentinel types of the (const) underlying view
+  // (only requires the const view to be a range if it is used, so that
+  //  views that are not const-iterable such as istream views are supported):
+  template<bool ConstT, typename V>
+  struct MaybeConstIterators {
+    using iterator = std::ranges::iterator_t<V>;
+    using sentinel = std::ranges::sentinel_t<V>;
+  };
+  template<typename V>
+  requires std::ranges::range<const V>
+  struct MaybeConstIterators<true, V> {
+    using iterator = const_iterator_t<const V>;
+    using sentinel = const_sentinel_t<const V>;
+  };
+} // namespace belleviews::_intern
+
 #endif // BELLEVIEWSUTILS_HPP
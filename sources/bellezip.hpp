@@ -0,0 +1,517 @@
+// <bellezip.hpp> -*- C++ -*-
+//
+// Copyright (C) 2019-2022 Free Software Foundation, Inc.
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library,
+// which is using parts of the GNU ISO C++ Library.  
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+
+#ifndef BELLEZIP_HPP
+#define BELLEZIP_HPP
+
+#include <concepts>
+#include <ranges>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <span>
+#include <algorithm>
+#include <type_traits>
+
+//*************************************************************
+// class belleviews::zip_tuple<>
+//
+// The reference type of zip_view iterators
+// - a std::tuple<> of the references to the elements of all ranges
+// - C++20 has no common reference of std::tuple<int&> and std::tuple<int>&,
+//   which is required for iterators yielding tuples of references
+//   (C++23 adds it to std::tuple<>)
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+template<typename... Ts>
+class zip_tuple : public std::tuple<Ts...>
+{
+ private:
+  template<typename Tuple, std::size_t... Idx>
+  constexpr zip_tuple(Tuple&& t, std::index_sequence<Idx...>)
+   : std::tuple<Ts...>(std::get<Idx>(std::forward<Tuple>(t))...) {
+  }
+
+ public:
+  using std::tuple<Ts...>::tuple;
+
+  // bind to/convert the elements of other tuples
+  // (e.g. references to the elements of a value):
+  template<typename... Us>
+  requires (sizeof...(Us) == sizeof...(Ts)) && (std::constructible_from<Ts, Us&> && ...)
+  constexpr zip_tuple(std::tuple<Us...>& t)
+   : zip_tuple(t, std::index_sequence_for<Ts...>{}) {
+  }
+  template<typename... Us>
+  requires (sizeof...(Us) == sizeof...(Ts)) && (std::constructible_from<Ts, const Us&> && ...)
+  constexpr zip_tuple(const std::tuple<Us...>& t)
+   : zip_tuple(t, std::index_sequence_for<Ts...>{}) {
+  }
+  template<typename... Us>
+  requires (sizeof...(Us) == sizeof...(Ts)) && (std::constructible_from<Ts, Us> && ...)
+  constexpr zip_tuple(std::tuple<Us...>&& t)
+   : zip_tuple(std::move(t), std::index_sequence_for<Ts...>{}) {
+  }
+  template<typename... Us>
+  requires (sizeof...(Us) == sizeof...(Ts)) && (std::constructible_from<Ts, const Us> && ...)
+  constexpr zip_tuple(const std::tuple<Us...>&& t)
+   : zip_tuple(std::move(t), std::index_sequence_for<Ts...>{}) {
+  }
+};
+
+} // namespace belleviews
+
+template<typename... Ts>
+struct std::tuple_size<belleviews::zip_tuple<Ts...>>
+ : std::integral_constant<std::size_t, sizeof...(Ts)> {
+};
+
+template<std::size_t Idx, typename... Ts>
+struct std::tuple_element<Idx, belleviews::zip_tuple<Ts...>>
+ : std::tuple_element<Idx, std::tuple<Ts...>> {
+};
+
+// common references with other zip_tuples and std::tuples:
+template<typename... Ts, typename... Us,
+         template<typename> class TQual, template<typename> class UQual>
+requires (sizeof...(Ts) == sizeof...(Us))
+         && requires { typename belleviews::zip_tuple<std::common_reference_t<TQual<Ts>, UQual<Us>>...>; }
+struct std::basic_common_reference<belleviews::zip_tuple<Ts...>, belleviews::zip_tuple<Us...>, TQual, UQual> {
+  using type = belleviews::zip_tuple<std::common_reference_t<TQual<Ts>, UQual<Us>>...>;
+};
+
+template<typename... Ts, typename... Us,
+         template<typename> class TQual, template<typename> class UQual>
+requires (sizeof...(Ts) == sizeof...(Us))
+         && requires { typename belleviews::zip_tuple<std::common_reference_t<TQual<Ts>, UQual<Us>>...>; }
+struct std::basic_common_reference<belleviews::zip_tuple<Ts...>, std::tuple<Us...>, TQual, UQual> {
+  using type = belleviews::zip_tuple<std::common_reference_t<TQual<Ts>, UQual<Us>>...>;
+};
+
+template<typename... Ts, typename... Us,
+         template<typename> class TQual, template<typename> class UQual>
+requires (sizeof...(Ts) == sizeof...(Us))
+         && requires { typename belleviews::zip_tuple<std::common_reference_t<TQual<Ts>, UQual<Us>>...>; }
+struct std::basic_common_reference<std::tuple<Ts...>, belleviews::zip_tuple<Us...>, TQual, UQual> {
+  using type = belleviews::zip_tuple<std::common_reference_t<TQual<Ts>, UQual<Us>>...>;
+};
+
+
+//*************************************************************
+// class belleviews::zip_view
+//
+// A C++ view iterating over multiple ranges in lockstep
+// (e.g. over the columns of a struct-of-arrays layout)
+// with the following benefits compared to C++ standard views
+// - Iterating is stateless
+// - Can iterate over const views
+// - Concurrent iterations are safe
+// - Always propagates const
+// Because
+// - This view does not cache anything
+// - This view yields const iterators for all ranges when it is const
+//   (the elements are zip_tuple<>s of const references)
+// Also:
+// - keeps random access and size() if all ranges have them
+// - columns() yields the std::span<>s of all ranges if they are contiguous
+//   (so that vectorized kernels can process the columns without creating tuples)
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  // helpers to process the tuples of iterators/sentinels of zip_view elementwise:
+  template<typename Tuple, typename...>
+  inline constexpr std::size_t tupleSize = std::tuple_size_v<std::remove_cvref_t<Tuple>>;
+
+  // apply op to the I-th elements of the tuples ts for all I:
+  template<typename Op, typename... Tuples>
+  constexpr auto zipAtIndex(Op& op, Tuples&... ts) {
+    return [&]<std::size_t I>(std::integral_constant<std::size_t, I>) -> decltype(auto) {
+      return op(std::get<I>(ts)...);
+    };
+  }
+  template<typename Op, typename... Tuples>
+  constexpr void zipForEach(Op op, Tuples&... ts) {
+    auto at = zipAtIndex(op, ts...);
+    [&]<std::size_t... Idx>(std::index_sequence<Idx...>) {
+      (at(std::integral_constant<std::size_t, Idx>{}), ...);
+    }(std::make_index_sequence<tupleSize<Tuples...>>{});
+  }
+  template<typename Op, typename... Tuples>
+  constexpr bool zipAnyOf(Op op, Tuples&... ts) {
+    auto at = zipAtIndex(op, ts...);
+    return [&]<std::size_t... Idx>(std::index_sequence<Idx...>) {
+      return (at(std::integral_constant<std::size_t, Idx>{}) || ...);
+    }(std::make_index_sequence<tupleSize<Tuples...>>{});
+  }
+  // minimum distance (by absolute value) of all ranges:
+  template<typename DiffT, typename Op, typename... Tuples>
+  constexpr DiffT zipMinDistance(Op op, Tuples&... ts) {
+    auto at = zipAtIndex(op, ts...);
+    return [&]<std::size_t... Idx>(std::index_sequence<Idx...>) {
+      DiffT dists[] = {static_cast<DiffT>(at(std::integral_constant<std::size_t, Idx>{}))...};
+      return std::ranges::min(dists, {}, [](DiffT d) { return d < 0 ? -d : d; });
+    }(std::make_index_sequence<tupleSize<Tuples...>>{});
+  }
+} // namespace _intern
+
+template<std::ranges::input_range... Vs>
+requires (sizeof...(Vs) > 0) && (std::ranges::view<Vs> && ...)
+class zip_view : public std::ranges::view_interface<zip_view<Vs...>>
+{
+ private:
+  // one iterator and sentinel type for both the non-const and the const view
+  // (the const one iterates with const iterators of the underlying const views):
+  template<bool ConstT, typename V>
+  using VIter = typename _intern::MaybeConstIterators<ConstT, V>::iterator;
+  template<bool ConstT, typename V>
+  using VSent = typename _intern::MaybeConstIterators<ConstT, V>::sentinel;
+
+  static constexpr bool allForward = (std::ranges::forward_range<Vs> && ...);
+  static constexpr bool allBidirectional = (std::ranges::bidirectional_range<Vs> && ...);
+  static constexpr bool allRandomAccess = (std::ranges::random_access_range<Vs> && ...);
+
+  template<bool ConstT>
+  class Iterator
+  {
+   private:
+    static constexpr auto _s_iter_concept() {
+      if constexpr (allRandomAccess)
+        return std::random_access_iterator_tag{};
+      else if constexpr (allBidirectional)
+        return std::bidirectional_iterator_tag{};
+      else if constexpr (allForward)
+        return std::forward_iterator_tag{};
+      else
+        return std::input_iterator_tag{};
+    }
+
+   public:
+    using iterator_category = std::input_iterator_tag;   // operator* yields prvalues
+    using iterator_concept = decltype(_s_iter_concept());
+    using value_type = std::tuple<std::ranges::range_value_t<Vs>...>;
+    using reference = zip_tuple<std::iter_reference_t<VIter<ConstT, Vs>>...>;
+    using difference_type = std::common_type_t<std::ranges::range_difference_t<Vs>...>;
+
+   private:
+    friend zip_view;
+    friend Iterator<!ConstT>;
+    template<bool> friend class Sentinel;
+    std::tuple<VIter<ConstT, Vs>...> current_;
+
+    constexpr explicit Iterator(std::tuple<VIter<ConstT, Vs>...> cur)
+     : current_{std::move(cur)} {
+    }
+
+   public:
+    Iterator() = default;
+
+    constexpr Iterator(Iterator<!ConstT> i)
+      requires ConstT && (std::convertible_to<VIter<false, Vs>, VIter<true, Vs>> && ...)
+     : current_{std::move(i.current_)} {
+    }
+
+    constexpr const auto& base() const noexcept {
+      return current_;
+    }
+
+    constexpr reference operator*() const {
+      return std::apply([](const auto&... its) { return reference(*its...); }, current_);
+    }
+
+    constexpr Iterator& operator++() {
+      _intern::zipForEach([](auto& it) { ++it; }, current_);
+      return *this;
+    }
+    constexpr void operator++(int) {
+      ++*this;
+    }
+    constexpr Iterator operator++(int) requires allForward {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+    constexpr Iterator& operator--() requires allBidirectional {
+      _intern::zipForEach([](auto& it) { --it; }, current_);
+      return *this;
+    }
+    constexpr Iterator operator--(int) requires allBidirectional {
+      auto tmp = *this;
+      --*this;
+      return tmp;
+    }
+
+    constexpr Iterator& operator+=(difference_type n) requires allRandomAccess {
+      _intern::zipForEach([n](auto& it) { it += std::iter_difference_t<std::remove_cvref_t<decltype(it)>>(n); }, current_);
+      return *this;
+    }
+    constexpr Iterator& operator-=(difference_type n) requires allRandomAccess {
+      _intern::zipForEach([n](auto& it) { it -= std::iter_difference_t<std::remove_cvref_t<decltype(it)>>(n); }, current_);
+      return *this;
+    }
+    constexpr reference operator[](difference_type n) const requires allRandomAccess {
+      return *(*this + n);
+    }
+
+    // all iterators move in lockstep, so one equal iterator is enough
+    // unless the ranges are bidirectional (where ranges of different size might end at different positions):
+    friend constexpr bool operator==(const Iterator& x, const Iterator& y)
+      requires (std::equality_comparable<VIter<ConstT, Vs>> && ...) {
+      if constexpr (allBidirectional) {
+        return x.current_ == y.current_;
+      }
+      else {
+        return _intern::zipAnyOf([](const auto& i1, const auto& i2) { return i1 == i2; }, x.current_, y.current_);
+      }
+    }
+    friend constexpr bool operator<(const Iterator& x, const Iterator& y) requires allRandomAccess {
+      return x.current_ < y.current_;
+    }
+    friend constexpr bool operator>(const Iterator& x, const Iterator& y) requires allRandomAccess {
+      return y < x;
+    }
+    friend constexpr bool operator<=(const Iterator& x, const Iterator& y) requires allRandomAccess {
+      return !(y < x);
+    }
+    friend constexpr bool operator>=(const Iterator& x, const Iterator& y) requires allRandomAccess {
+      return !(x < y);
+    }
+
+    friend constexpr Iterator operator+(const Iterator& i, difference_type n) requires allRandomAccess {
+      auto r = i;
+      r += n;
+      return r;
+    }
+    friend constexpr Iterator operator+(difference_type n, const Iterator& i) requires allRandomAccess {
+      return i + n;
+    }
+    friend constexpr Iterator operator-(const Iterator& i, difference_type n) requires allRandomAccess {
+      auto r = i;
+      r -= n;
+      return r;
+    }
+    friend constexpr difference_type operator-(const Iterator& x, const Iterator& y)
+      requires (std::sized_sentinel_for<VIter<ConstT, Vs>, VIter<ConstT, Vs>> && ...) {
+      return _intern::zipMinDistance<difference_type>([](const auto& i1, const auto& i2) { return i1 - i2; },
+                                          x.current_, y.current_);
+    }
+
+    friend constexpr auto iter_move(const Iterator& i)
+      noexcept((noexcept(std::ranges::iter_move(std::declval<const VIter<ConstT, Vs>&>())) && ...)) {
+      using RRef = zip_tuple<std::iter_rvalue_reference_t<VIter<ConstT, Vs>>...>;
+      return std::apply([](const auto&... its) { return RRef(std::ranges::iter_move(its)...); }, i.current_);
+    }
+  };
+
+  template<bool ConstT>
+  class Sentinel
+  {
+   private:
+    friend zip_view;
+    friend Sentinel<!ConstT>;
+    std::tuple<VSent<ConstT, Vs>...> end_;
+
+    constexpr explicit Sentinel(std::tuple<VSent<ConstT, Vs>...> end)
+     : end_{std::move(end)} {
+    }
+
+    template<bool OtherConst>
+    constexpr bool equal(const Iterator<OtherConst>& i) const {
+      return _intern::zipAnyOf([](const auto& it, const auto& end) { return it == end; }, i.current_, end_);
+    }
+    template<bool OtherConst>
+    constexpr auto distanceTo(const Iterator<OtherConst>& i) const {
+      using DiffT = typename Iterator<OtherConst>::difference_type;
+      return _intern::zipMinDistance<DiffT>([](const auto& it, const auto& end) { return end - it; }, i.current_, end_);
+    }
+
+   public:
+    Sentinel() = default;
+
+    constexpr Sentinel(Sentinel<!ConstT> s)
+      requires ConstT && (std::convertible_to<VSent<false, Vs>, VSent<true, Vs>> && ...)
+     : end_{std::move(s.end_)} {
+    }
+
+    template<bool OtherConst>
+    requires (std::sentinel_for<VSent<ConstT, Vs>, VIter<OtherConst, Vs>> && ...)
+    friend constexpr bool operator==(const Iterator<OtherConst>& i, const Sentinel& s) {
+      return s.equal(i);
+    }
+    template<bool OtherConst>
+    requires (std::sized_sentinel_for<VSent<ConstT, Vs>, VIter<OtherConst, Vs>> && ...)
+    friend constexpr auto operator-(const Sentinel& s, const Iterator<OtherConst>& i) {
+      return s.distanceTo(i);
+    }
+    template<bool OtherConst>
+    requires (std::sized_sentinel_for<VSent<ConstT, Vs>, VIter<OtherConst, Vs>> && ...)
+    friend constexpr auto operator-(const Iterator<OtherConst>& i, const Sentinel& s) {
+      return -s.distanceTo(i);
+    }
+  };
+
+ private:
+  std::tuple<Vs...> bases_;
+
+  template<bool ConstT, typename Self>
+  static constexpr auto beginImpl(Self& self) {
+    return Iterator<ConstT>{std::apply([](auto&... bases) {
+                                         if constexpr (ConstT) {
+                                           return std::tuple{std::make_const_iterator(std::ranges::begin(bases))...};
+                                         }
+                                         else {
+                                           return std::tuple{std::ranges::begin(bases)...};
+                                         }
+                                       }, self.bases_)};
+  }
+  template<bool ConstT, typename Self>
+  static constexpr auto endImpl(Self& self) {
+    auto ends = std::apply([](auto&... bases) {
+                             if constexpr (ConstT) {
+                               return std::tuple{std::make_const_sentinel(std::ranges::end(bases))...};
+                             }
+                             else {
+                               return std::tuple{std::ranges::end(bases)...};
+                             }
+                           }, self.bases_);
+    constexpr bool allCommon = (std::ranges::common_range<_intern::maybe_const_t<ConstT, Vs>> && ...);
+    constexpr bool allSized = (std::ranges::sized_range<_intern::maybe_const_t<ConstT, Vs>> && ...);
+    if constexpr (allRandomAccess && allSized) {
+      // ranges of different size end at the end of the shortest one:
+      return beginImpl<ConstT>(self) + typename Iterator<ConstT>::difference_type(self.size());
+    }
+    else if constexpr (allCommon && (sizeof...(Vs) == 1 || !allBidirectional)) {
+      return Iterator<ConstT>{std::move(ends)};
+    }
+    else {
+      return Sentinel<ConstT>{std::move(ends)};
+    }
+  }
+
+  template<typename T>
+  static constexpr std::span<const T> constSpan(T* data, std::size_t sz) {
+    return std::span<const T>{data, sz};
+  }
+
+  template<typename Self>
+  static constexpr auto sizeImpl(Self& self) {
+    return std::apply([](auto&... bases) {
+                        using SizeT = _intern::make_unsigned_like_t<std::common_type_t<decltype(std::ranges::size(bases))...>>;
+                        return std::ranges::min({static_cast<SizeT>(std::ranges::size(bases))...});
+                      }, self.bases_);
+  }
+
+ public:
+  zip_view() = default;
+
+  constexpr explicit zip_view(Vs... bases)
+   : bases_{std::move(bases)...} {
+  }
+
+  constexpr auto begin() {
+    return beginImpl<false>(*this);
+  }
+  constexpr auto begin() const requires (std::ranges::input_range<const Vs> && ...) {
+    return beginImpl<true>(*this);
+  }
+
+  constexpr auto end() {
+    return endImpl<false>(*this);
+  }
+  constexpr auto end() const requires (std::ranges::input_range<const Vs> && ...) {
+    return endImpl<true>(*this);
+  }
+
+  constexpr auto size() requires (std::ranges::sized_range<Vs> && ...) {
+    return sizeImpl(*this);
+  }
+  constexpr auto size() const requires (std::ranges::sized_range<const Vs> && ...) {
+    return sizeImpl(*this);
+  }
+
+  // the columns as std::spans (of const elements if the view is const)
+  // with the size of the shortest range:
+  constexpr auto columns()
+    requires ((std::ranges::contiguous_range<Vs> && std::ranges::sized_range<Vs>) && ...) {
+    auto sz = static_cast<std::size_t>(size());
+    return std::apply([sz](auto&... bases) {
+                        return std::tuple{std::span{std::ranges::data(bases), sz}...};
+                      }, bases_);
+  }
+  constexpr auto columns() const
+    requires ((std::ranges::contiguous_range<const Vs> && std::ranges::sized_range<const Vs>) && ...) {
+    auto sz = static_cast<std::size_t>(size());
+    return std::apply([sz](auto&... bases) {
+                        return std::tuple{constSpan(std::ranges::data(bases), sz)...};
+                      }, bases_);
+  }
+};
+
+template<typename... Rgs>
+zip_view(Rgs&&...) -> zip_view<std::views::all_t<Rgs>...>;
+
+} // namespace belleviews
+
+// borrowed if all underlying ranges are borrowed (as with std zip_view):
+template<typename... Vs>
+inline constexpr bool std::ranges::enable_borrowed_range<belleviews::zip_view<Vs...>> = (std::ranges::enable_borrowed_range<Vs> && ...);
+
+
+//*************************************************************
+// belleviews::zip()
+// bel::views::zip()
+//
+// A C++ zip_view adaptor for the belleviews::zip_view
+//*************************************************************
+BELLEVIEWS_EXPORT namespace belleviews {
+
+namespace _intern {
+  template<typename... Rgs>
+  concept can_zip_view = requires { zip_view(std::declval<Rgs>()...); };
+}
+
+struct Zip {
+   // for:  bel::views::zip(rg1, rg2, ...)
+   template<std::ranges::viewable_range... Rgs>
+   requires (sizeof...(Rgs) > 0) && _intern::can_zip_view<Rgs...>
+   constexpr auto
+   operator() [[nodiscard]] (Rgs&&... rgs) const {
+     return zip_view{std::forward<Rgs>(rgs)...};
+   }
+};
+
+// belleviews::zip() :
+inline constexpr Zip zip;
+
+} // namespace belleviews
+
+BELLEVIEWS_EXPORT namespace bel::views {
+  // bel::views::zip() :
+  inline constexpr belleviews::Zip zip;
+}
+
+#endif // BELLEZIP_HPP
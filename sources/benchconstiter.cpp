@@ -0,0 +1,62 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <array>
+#include <algorithm>
+#include "belleviews.hpp"
+#include "benchutils.hpp"
+
+//**********************************************************************
+// Compare iterating over a belle view with iterating over the same view when const.
+// Over contiguous memory both should yield the same loops and calls
+// (e.g., copy() of a const view should still become a memmove()).
+//**********************************************************************
+
+constexpr int reps = 50;
+
+long sumElems(auto&& coll)
+{
+  long sum = 0;
+  for (const auto& elem : coll) {
+    sum += elem;
+  }
+  return sum;
+}
+
+void benchConstAndNonConst(const std::string& name, auto&& v, std::vector<int>& out)
+{
+  const auto& cv = v;
+  static_assert(std::ranges::contiguous_range<decltype(cv)>);
+  std::size_t num = std::ranges::size(cv);
+
+  double ns1 = bench::measureNs(reps, [&] { bench::doNotOptimize(sumElems(v)); });
+  double ns2 = bench::measureNs(reps, [&] { bench::doNotOptimize(sumElems(cv)); });
+  bench::report(name + " sum", ns1, num);
+  bench::report(name + " sum (const)", ns2, num);
+
+  double ns3 = bench::measureNs(reps, [&] { std::copy(v.begin(), v.end(), out.begin());
+                                            bench::doNotOptimize(out); });
+  double ns4 = bench::measureNs(reps, [&] { std::copy(cv.begin(), cv.end(), out.begin());
+                                            bench::doNotOptimize(out); });
+  bench::report(name + " copy", ns3, num);
+  bench::report(name + " copy (const)", ns4, num);
+}
+
+int main()
+{
+  for (int size : {1'000, 100'000, 10'000'000}) {
+    std::cout << "\n==== " << size << " elements:\n";
+    std::vector<int> coll(size);
+    for (int i = 0; i < size; ++i) {
+      coll[i] = i % 100;
+    }
+    std::vector<int> out(size);
+
+    benchConstAndNonConst("all(vec)", bel::views::all(coll), out);
+    benchConstAndNonConst("drop(vec, 2)", coll | bel::views::drop(2), out);
+    benchConstAndNonConst("take(vec, n-2)", coll | bel::views::take(size - 2), out);
+    benchConstAndNonConst("drop_while(vec, <0)", coll | bel::views::drop_while([](int i) { return i < 0; }),
+                          out);
+    benchConstAndNonConst("sub(ptr, ptr)", bel::views::sub(coll.data(), coll.data() + size), out);
+  }
+}
@@ -0,0 +1,72 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <list>
+#include <deque>
+#include "belleviews.hpp"
+#include "belletransform.hpp"
+#include "benchutils.hpp"
+
+//**********************************************************************
+// Iterate over 6-deep pipelines of belle views (const and non-const).
+// Mainly meant to be compiled with -O0 and -Og
+// to see the cost of the iterator layers in debug builds.
+// Compile times are measured by the Makefile targets benchdeep*.
+//**********************************************************************
+
+constexpr int reps = 10;
+
+auto notTimes3 = [] (int i) { return i % 3 != 0; };
+auto times2 = [] (int i) { return i * 2; };
+auto lessThan4 = [] (int i) { return i < 4; };
+
+auto pipeline(auto& coll)
+{
+  return coll | bel::views::drop(1)
+              | bel::views::filter(notTimes3)
+              | bel::views::transform(times2)
+              | bel::views::take(1'000'000'000)
+              | bel::views::drop_while(lessThan4)
+              | bel::views::drop(1);
+}
+
+long sumElems(auto&& coll)
+{
+  long sum = 0;
+  for (const auto& elem : coll) {
+    sum += elem;
+  }
+  return sum;
+}
+
+template<typename Coll>
+void benchPipeline(const std::string& name, int size)
+{
+  Coll coll;
+  for (int i = 0; i < size; ++i) {
+    coll.push_back(i % 100);
+  }
+  auto v = pipeline(coll);
+  const auto& cv = v;
+
+  double ns1 = bench::measureNs(reps, [&] { bench::doNotOptimize(sumElems(v)); });
+  double ns2 = bench::measureNs(reps, [&] { bench::doNotOptimize(sumElems(cv)); });
+  bench::report(name + " 6-deep pipeline", ns1, size);
+  bench::report(name + " 6-deep pipeline (const)", ns2, size);
+
+  int copies = 1'000;
+  double ns3 = bench::measureNs(reps, [&] { for (int i = 0; i < copies; ++i) {
+                                              auto vCopy = v;
+                                              bench::doNotOptimize(vCopy);
+                                            }});
+  bench::report(name + " copy 6-deep pipeline", ns3, copies);
+  std::cout << name << " sizeof(6-deep pipeline): " << sizeof(v) << '\n';
+}
+
+int main()
+{
+  int size = 1'000'000;
+  benchPipeline<std::vector<int>>("vector", size);
+  benchPipeline<std::deque<int>>("deque", size);
+  benchPipeline<std::list<int>>("list", size);
+}
@@ -0,0 +1,59 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <list>
+#include "belleviews.hpp"
+#include "benchutils.hpp"
+
+//**********************************************************************
+// Compare iterating over a belle filter view with iterating over the same view when const.
+// Both use the same iterator template and increment, so they should have the same speed.
+// For the code size of the filter iterators compare the text size of the object file:
+//   g++ --std=c++20 -O2 -c benchfilter.cpp && size benchfilter.o
+//**********************************************************************
+
+constexpr int reps = 20;
+
+auto isEven = [] (int i) { return i % 2 == 0; };
+
+long sumElems(auto&& coll)
+{
+  long sum = 0;
+  for (const auto& elem : coll) {
+    sum += elem;
+  }
+  return sum;
+}
+
+template<typename Coll>
+void benchConstAndNonConst(const std::string& name, int size)
+{
+  Coll coll;
+  for (int i = 0; i < size; ++i) {
+    coll.push_back(i % 100);
+  }
+
+  auto v = coll | bel::views::filter(isEven);
+  const auto& cv = v;
+
+  double ns1 = bench::measureNs(reps, [&] { bench::doNotOptimize(sumElems(v)); });
+  double ns2 = bench::measureNs(reps, [&] { bench::doNotOptimize(sumElems(cv)); });
+  bench::report("filter(" + name + ") sum", ns1, size);
+  bench::report("filter(" + name + ") sum (const)", ns2, size);
+
+  double ns3 = bench::measureNs(reps, [&] { bench::doNotOptimize(std::ranges::count(v, 42)); });
+  double ns4 = bench::measureNs(reps, [&] { bench::doNotOptimize(std::ranges::count(cv, 42)); });
+  bench::report("filter(" + name + ") count", ns3, size);
+  bench::report("filter(" + name + ") count (const)", ns4, size);
+}
+
+int main()
+{
+  for (int size : {1'000, 100'000, 1'000'000}) {
+    std::cout << "\n==== " << size << " elements:\n";
+    benchConstAndNonConst<std::vector<int>>("vector", size);
+    benchConstAndNonConst<std::deque<int>>("deque", size);
+    benchConstAndNonConst<std::list<int>>("list", size);
+  }
+}
@@ -0,0 +1,85 @@
+#include <vector>
+#include <deque>
+#include <list>
+#include <forward_list>
+#include <utility>
+#include <ranges>
+#include "belleviews.hpp"
+#include "belletransform.hpp"
+
+//**********************************************************************
+// Translation unit to measure the compile-time cost of pipelines
+// (generated by benchinstantiation.sh with different macros):
+// - BENCH_LIB:        1: bel::views  2: bel::views also iterated when const  else: std::views
+// - BENCH_CONTAINER:  std::vector, std::deque, std::list, std::forward_list
+// - BENCH_DEPTH:      number of views in the pipeline (1 to 8)
+//**********************************************************************
+
+#ifndef BENCH_LIB
+#define BENCH_LIB 1
+#endif
+#ifndef BENCH_CONTAINER
+#define BENCH_CONTAINER std::vector
+#endif
+#ifndef BENCH_DEPTH
+#define BENCH_DEPTH 8
+#endif
+
+#if BENCH_LIB == 1 || BENCH_LIB == 2
+namespace vws = bel::views;
+#else
+namespace vws = std::views;
+#endif
+
+auto isOdd = [] (int i) { return i % 2 != 0; };
+auto times2 = [] (int i) { return i * 2; };
+auto lessThan4 = [] (int i) { return i < 4; };
+
+auto pipeline(auto& coll)
+{
+  return coll
+#if BENCH_DEPTH >= 1
+              | vws::drop(1)
+#endif
+#if BENCH_DEPTH >= 2
+              | vws::filter(isOdd)
+#endif
+#if BENCH_DEPTH >= 3
+              | vws::transform(times2)
+#endif
+#if BENCH_DEPTH >= 4
+              | vws::take(1'000)
+#endif
+#if BENCH_DEPTH >= 5
+              | vws::drop_while(lessThan4)
+#endif
+#if BENCH_DEPTH >= 6
+              | vws::drop(1)
+#endif
+#if BENCH_DEPTH >= 7
+              | vws::filter(isOdd)
+#endif
+#if BENCH_DEPTH >= 8
+              | vws::transform(times2)
+#endif
+              ;
+}
+
+int sumElems(auto&& coll)
+{
+  int sum = 0;
+  for (const auto& elem : coll) {
+    sum += elem;
+  }
+  return sum;
+}
+
+int bench(BENCH_CONTAINER<int>& coll)
+{
+  auto v = pipeline(coll);
+  int sum = sumElems(v);
+#if BENCH_LIB == 2
+  sum += sumElems(std::as_const(v));
+#endif
+  return sum;
+}
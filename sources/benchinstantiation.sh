@@ -0,0 +1,69 @@
+#!/bin/sh
+#
+# benchinstantiation.sh
+#
+# Measure the compile-time cost of pipelines of depth 1 to 8
+# over several containers with std::views and bel::views
+# (compiling benchinstantiation.cpp with different macros).
+#
+# usage: ./benchinstantiation.sh [outfile.csv]
+#   CXX=clang++ CXXFLAGS="--std=c++20 -O0" ./benchinstantiation.sh   # other compiler/flags
+#
+# For each configuration the CSV file gets:
+# - the wall-clock compile time in seconds
+# - the time for template instantiation and the total GGC memory in kB
+#   (both from gcc's -ftime-report, empty for other compilers)
+# - the size of the object file in bytes and its text segment (from size)
+#
+# lib is std, bel, or bel_const (bel::views also iterated when const).
+
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:-"--std=c++20 -O2"}
+OUT=${1:-benchinstantiation.csv}
+TMPDIR=${TMPDIR:-/tmp}/benchinstantiation.$$
+
+mkdir -p "$TMPDIR"
+trap 'rm -rf "$TMPDIR"' EXIT
+
+# toKB value: convert -ftime-report memory values (8536, 1238k, 69M) into kB
+toKB()
+{
+  echo "$1" | awk '/M$/ { printf "%d", $0 * 1024; next }
+                   /k$/ { printf "%d", $0; next }
+                        { printf "%d", $0 / 1024 }'
+}
+
+echo "compiler,lib,container,depth,seconds,instantiation_seconds,ggc_kb,object_bytes,text_bytes" > "$OUT"
+
+for lib in std bel bel_const; do
+  case $lib in
+    std)       libnum=0 ;;
+    bel)       libnum=1 ;;
+    bel_const) libnum=2 ;;
+  esac
+  for cont in vector deque list forward_list; do
+    depth=1
+    while [ $depth -le 8 ]; do
+      obj="$TMPDIR/bench.o"
+      report="$TMPDIR/report.txt"
+      start=$(date +%s.%N)
+      if $CXX $CXXFLAGS -ftime-report -I. -DBENCH_LIB=$libnum -DBENCH_CONTAINER=std::$cont \
+              -DBENCH_DEPTH=$depth -c benchinstantiation.cpp -o "$obj" 2> "$report"; then
+        end=$(date +%s.%N)
+        secs=$(echo "$start $end" | awk '{ printf "%.3f", $2 - $1 }')
+        # -ftime-report columns after the colon (without percentages): usr sys wall GGC
+        inst=$(awk -F: '/^ template instantiation/ { gsub(/\([^)]*\)/, "", $2); split($2, c, " "); print c[3] }' "$report")
+        ggc=$(awk -F: '/^ TOTAL/ { split($2, c, " "); print c[4] }' "$report")
+        [ -n "$ggc" ] && ggc=$(toKB "$ggc")
+        objsize=$(wc -c < "$obj" | tr -d ' ')
+        textsize=$(size "$obj" | awk 'NR == 2 { print $1 }')
+      else
+        secs=FAILED; inst=; ggc=; objsize=; textsize=
+      fi
+      line="$CXX,$lib,$cont,$depth,$secs,$inst,$ggc,$objsize,$textsize"
+      echo "$line" >> "$OUT"
+      echo "$line"
+      depth=$((depth + 1))
+    done
+  done
+done
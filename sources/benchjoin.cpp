@@ -0,0 +1,72 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <ranges>
+#include "belleviews.hpp"
+#include "benchutils.hpp"
+
+//**********************************************************************
+// Compare flattening many small inner vectors:
+// - with a hand-written nested loop
+// - by iterating over std::views::join and bel::views::join
+//   (each increment checks the inner end and might reload the outer position)
+// - with bel::for_each() over bel::views::join
+//   (a tight inner loop per segment)
+//**********************************************************************
+
+constexpr int reps = 20;
+
+long sumNested(const std::vector<std::vector<int>>& coll)
+{
+  long sum = 0;
+  for (const auto& inner : coll) {
+    for (int i : inner) {
+      sum += i;
+    }
+  }
+  return sum;
+}
+
+long sumElems(auto&& coll)
+{
+  long sum = 0;
+  for (int i : coll) {
+    sum += i;
+  }
+  return sum;
+}
+
+void benchJoin(int numInner, int maxInnerSize)
+{
+  std::vector<std::vector<int>> coll(numInner);
+  std::size_t numElems = 0;
+  for (int i = 0; i < numInner; ++i) {
+    coll[i].resize(i % (maxInnerSize + 1));   // some inner vectors are empty
+    numElems += coll[i].size();
+  }
+
+  auto stdVw = coll | std::views::join;
+  const auto belVw = coll | bel::views::join();
+  std::string name = "join(" + std::to_string(numInner) + " x 0.." + std::to_string(maxInnerSize) + ")";
+
+  double ns1 = bench::measureNs(reps, [&] { bench::doNotOptimize(sumNested(coll)); });
+  double ns2 = bench::measureNs(reps, [&] { bench::doNotOptimize(sumElems(stdVw)); });
+  double ns3 = bench::measureNs(reps, [&] { bench::doNotOptimize(sumElems(belVw)); });
+  double ns4 = bench::measureNs(reps, [&] {
+                                        long sum = 0;
+                                        bel::for_each(belVw, [&](int i) { sum += i; });
+                                        bench::doNotOptimize(sum);
+                                      });
+  bench::report(name + " nested loops", ns1, numElems);
+  bench::report(name + " std::views::join", ns2, numElems);
+  bench::report(name + " bel::views::join", ns3, numElems);
+  bench::report(name + " bel::for_each(bel::views::join)", ns4, numElems);
+}
+
+int main()
+{
+  for (int maxInnerSize : {4, 16, 64}) {
+    std::cout << "\n==== inner vectors with up to " << maxInnerSize << " elements:\n";
+    benchJoin(100'000, maxInnerSize);
+  }
+}
@@ -0,0 +1,76 @@
+#!/bin/sh
+#
+# benchmodules.sh
+#
+# Compare the compile time of the test*.cpp programs
+# - including the belleviews headers
+# - importing the C++20 module belleviews (see belleviews.cppm)
+# with gcc and clang (each compiler is skipped if it is not found).
+#
+# usage: ./benchmodules.sh [test*.cpp files]
+#   GXX=g++-13 CLANGXX=clang++-17 ./benchmodules.sh     # other compilers
+#   LIBS="-L/opt/tbb/lib -ltbb" ./benchmodules.sh          # other libraries
+#
+# NOTE: gcc 12 does not see partial specializations of variable templates
+# (enable_borrowed_range<>) exported by modules and might even crash,
+# so several tests fail to compile with -DBELLEVIEWS_USE_MODULE there.
+# Failures are reported as FAILED instead of a time.
+
+GXX=${GXX:-g++}
+CLANGXX=${CLANGXX:-clang++}
+FLAGS="--std=c++20 -O2"
+TESTS=${*:-test*.cpp}
+TMPDIR=${TMPDIR:-/tmp}/benchmodules.$$
+
+mkdir -p "$TMPDIR"
+trap 'rm -rf "$TMPDIR"' EXIT
+SRCDIR=$(pwd)
+
+# timeCmd cmd...: print the seconds cmd takes or FAILED
+timeCmd()
+{
+  start=$(date +%s.%N)
+  if "$@" > "$TMPDIR/out.txt" 2>&1; then
+    end=$(date +%s.%N)
+    echo "$start $end" | awk '{ printf "%8.2f s", $2 - $1 }'
+  else
+    printf "%10s" "FAILED"
+  fi
+}
+
+# linkLibs cxx: print the libraries to link (LIBS if set)
+# (parallel algorithms of libstdc++ need TBB if it is installed, as in CMakeLists.txt)
+linkLibs()
+{
+  if [ -n "${LIBS+set}" ]; then
+    echo "$LIBS"
+  elif echo "int main() {}" | $1 -xc++ - -ltbb -o "$TMPDIR/tbb.exe" > /dev/null 2>&1; then
+    echo "-ltbb"
+  fi
+}
+
+# benchCompiler name moduleCmd modFlags modObj:
+benchCompiler()
+{
+  cxx=$1
+  libs=$(linkLibs $cxx)
+  printf "\n==== %s (%s)\n" "$cxx" "$($cxx --version | head -n 1)"
+  printf "%-30s %10s\n" "module belleviews" "$(cd "$TMPDIR" && timeCmd $2)"
+  for t in $TESTS; do
+    hdr=$(timeCmd $cxx $FLAGS -I"$SRCDIR" "$SRCDIR/$t" $libs -o "$TMPDIR/hdr.exe")
+    mod=$(cd "$TMPDIR" && timeCmd $cxx $FLAGS $3 -DBELLEVIEWS_USE_MODULE -I"$SRCDIR" "$SRCDIR/$t" $4 $libs -o "$TMPDIR/mod.exe")
+    printf "%-30s header: %10s   module: %10s\n" "$t" "$hdr" "$mod"
+  done
+}
+
+if command -v "$GXX" > /dev/null; then
+  benchCompiler "$GXX" \
+    "$GXX $FLAGS -fmodules-ts -xc++ -c $SRCDIR/belleviews.cppm -o belleviews.o" \
+    "-fmodules-ts" "belleviews.o"
+fi
+
+if command -v "$CLANGXX" > /dev/null; then
+  benchCompiler "$CLANGXX" \
+    "$CLANGXX $FLAGS --precompile -xc++-module $SRCDIR/belleviews.cppm -o belleviews.pcm" \
+    "-fmodule-file=belleviews=belleviews.pcm" "belleviews.pcm"
+fi
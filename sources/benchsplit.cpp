@@ -0,0 +1,50 @@
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <ranges>
+#include "belleviews.hpp"
+#include "benchutils.hpp"
+
+//**********************************************************************
+// Compare splitting text into lines/fields:
+// - by iterating over std::views::split
+//   (compares one character after the other and yields subranges)
+// - by iterating over bel::views::split
+//   (searches with memchr() and yields string_views)
+//**********************************************************************
+
+constexpr int reps = 20;
+
+std::size_t sumLengths(auto&& coll)
+{
+  std::size_t sum = 0;
+  for (auto&& elem : coll) {
+    sum += std::string_view{elem.begin(), elem.end()}.size();
+  }
+  return sum;
+}
+
+void benchSplit(std::size_t len, std::size_t fieldLen)
+{
+  std::string text(len, 'x');
+  for (std::size_t i = fieldLen; i < text.size(); i += fieldLen + 1) {
+    text[i] = ',';
+  }
+
+  auto stdVw = text | std::views::split(',');
+  const auto belVw = text | bel::views::split(',');
+  std::string name = "split(" + std::to_string(len) + " chars, fields of " + std::to_string(fieldLen) + ")";
+
+  double ns1 = bench::measureNs(reps, [&] { bench::doNotOptimize(sumLengths(stdVw)); });
+  double ns2 = bench::measureNs(reps, [&] { bench::doNotOptimize(sumLengths(belVw)); });
+  bench::report(name + " std::views::split", ns1, text.size());
+  bench::report(name + " bel::views::split", ns2, text.size());
+}
+
+int main()
+{
+  for (std::size_t fieldLen : {8, 80, 800}) {
+    std::cout << "\n==== fields with " << fieldLen << " characters:\n";
+    benchSplit(10'000'000, fieldLen);
+  }
+}
@@ -0,0 +1,82 @@
+// <benchutils.hpp> -*- C++ -*-
+//
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+// If not, see <http://www.gnu.org/licenses/>.
+
+//**********************************************************************
+// Minimal helpers for the bench*.cpp programs
+// (no dependency to any benchmark framework)
+//**********************************************************************
+
+#ifndef BENCHUTILS_HPP
+#define BENCHUTILS_HPP
+
+#include <chrono>
+#include <string>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+
+namespace bench {
+
+// doNotOptimize():
+// - prevent the optimizer from dropping a computation whose result is not used
+template<typename T>
+inline void doNotOptimize(const T& val)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  asm volatile("" : : "r,m"(val) : "memory");
+#else
+  static volatile const void* sink;
+  sink = &val;
+#endif
+}
+
+// measureNs():
+// - call func() reps times and return the fastest run in nanoseconds
+template<typename Func>
+double measureNs(int reps, Func&& func)
+{
+  double best = 0;
+  for (int i = 0; i < reps; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    func();
+    auto end = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(end - start).count();
+    best = (i == 0) ? ns : std::min(best, ns);
+  }
+  return best;
+}
+
+// report():
+// - print one result line
+inline void report(const std::string& name, double ns, std::size_t numElems)
+{
+  std::cout << std::left << std::setw(48) << name << std::right
+            << std::setw(14) << std::fixed << std::setprecision(0) << ns << " ns"
+            << std::setw(10) << std::setprecision(3) << ns / double(numElems) << " ns/elem\n";
+}
+
+} // namespace bench
+
+#endif // BENCHUTILS_HPP
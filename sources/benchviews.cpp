@@ -0,0 +1,159 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <list>
+#include <deque>
+#include <iterator>
+#include <ranges>
+#include "belleviews.hpp"
+#include "belletransform.hpp"
+#include "benchutils.hpp"
+
+//**********************************************************************
+// Compare the runtime of each belle view with its std::views counterpart
+// - over vector, list, and deque with different sizes
+// - single pass:   create the view and iterate over it once
+//                  (std views might cache begin() for nothing here)
+// - repeated pass: create the view once and iterate over it several times
+//                  (here caching begin() might pay off)
+// Writes the results also to <basename>.csv and <basename>.json
+// (basename is passed as first argument, default: belleviews_bench)
+//**********************************************************************
+
+constexpr int reps = 5;      // measure each scenario reps times and take the fastest
+constexpr int passes = 10;   // number of iterations in the repeated-pass scenario
+
+struct Result {
+  std::string view;
+  std::string container;
+  std::size_t size;
+  std::string scenario;
+  std::string lib;
+  double ns;
+};
+
+long sumElems(auto&& coll)
+{
+  long sum = 0;
+  for (const auto& elem : coll) {
+    sum += elem;
+  }
+  return sum;
+}
+
+// measure single and repeated pass for the view created by makeView(coll):
+void benchScenarios(std::vector<Result>& results, const std::string& view,
+                    const std::string& collName, const std::string& lib,
+                    auto& coll, auto makeView)
+{
+  std::size_t size = std::ranges::size(coll);
+  std::string name = lib + "::" + view + "(" + collName + ", " + std::to_string(size) + ")";
+
+  double ns1 = bench::measureNs(reps, [&] { auto v = makeView(coll);
+                                            bench::doNotOptimize(sumElems(v)); });
+  bench::report(name + " single", ns1, size);
+  results.push_back(Result{view, collName, size, "single", lib, ns1});
+
+  auto v = makeView(coll);
+  double ns2 = bench::measureNs(reps, [&] { for (int i = 0; i < passes; ++i) {
+                                              bench::doNotOptimize(sumElems(v));
+                                            }});
+  bench::report(name + " repeated", ns2, size * passes);
+  results.push_back(Result{view, collName, size, "repeated", lib, ns2});
+}
+
+void benchView(std::vector<Result>& results, const std::string& view,
+               const std::string& collName, auto& coll, auto makeStdView, auto makeBelView)
+{
+  benchScenarios(results, view, collName, "std", coll, makeStdView);
+  benchScenarios(results, view, collName, "bel", coll, makeBelView);
+}
+
+template<typename Coll>
+void benchAllViews(std::vector<Result>& results, const std::string& collName, int size)
+{
+  Coll coll;
+  for (int i = 0; i < size; ++i) {
+    coll.push_back(i % 100);
+  }
+  auto isOdd = [] (int i) { return i % 2 != 0; };
+  auto times2 = [] (int i) { return i * 2; };
+  auto lessThan50 = [] (int i) { return i < 50; };
+  int half = size / 2;
+
+  benchView(results, "drop", collName, coll,
+            [=] (auto& c) { return c | std::views::drop(half); },
+            [=] (auto& c) { return c | bel::views::drop(half); });
+  benchView(results, "take", collName, coll,
+            [=] (auto& c) { return c | std::views::take(half); },
+            [=] (auto& c) { return c | bel::views::take(half); });
+  benchView(results, "filter", collName, coll,
+            [=] (auto& c) { return c | std::views::filter(isOdd); },
+            [=] (auto& c) { return c | bel::views::filter(isOdd); });
+  benchView(results, "transform", collName, coll,
+            [=] (auto& c) { return c | std::views::transform(times2); },
+            [=] (auto& c) { return c | bel::views::transform(times2); });
+  benchView(results, "drop_while", collName, coll,
+            [=] (auto& c) { return c | std::views::drop_while(lessThan50); },
+            [=] (auto& c) { return c | bel::views::drop_while(lessThan50); });
+  benchView(results, "sub", collName, coll,
+            [=] (auto& c) { return std::ranges::subrange(std::next(c.begin()), c.end()); },
+            [=] (auto& c) { return bel::views::sub(std::next(c.begin()), c.end()); });
+  // eager_begin() is compared with the caching std view:
+  benchView(results, "eager_begin", collName, coll,
+            [=] (auto& c) { return c | std::views::drop_while(lessThan50); },
+            [=] (auto& c) { return c | bel::views::drop_while(lessThan50)
+                                     | bel::views::eager_begin(); });
+  benchView(results, "cache_begin", collName, coll,
+            [=] (auto& c) { return c | std::views::drop_while(lessThan50); },
+            [=] (auto& c) { return c | bel::views::drop_while(lessThan50)
+                                     | bel::views::cache_begin(); });
+}
+
+void writeCSV(const std::string& filename, const std::vector<Result>& results)
+{
+  std::ofstream out{filename};
+  out << std::fixed << std::setprecision(3);
+  out << "view,container,size,scenario,lib,ns,ns_per_elem\n";
+  for (const auto& r : results) {
+    std::size_t elems = r.size * (r.scenario == "repeated" ? passes : 1);
+    out << r.view << ',' << r.container << ',' << r.size << ',' << r.scenario << ','
+        << r.lib << ',' << r.ns << ',' << r.ns / double(elems) << '\n';
+  }
+}
+
+void writeJSON(const std::string& filename, const std::vector<Result>& results)
+{
+  std::ofstream out{filename};
+  out << std::fixed << std::setprecision(3);
+  out << "[\n";
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const auto& r = results[i];
+    std::size_t elems = r.size * (r.scenario == "repeated" ? passes : 1);
+    out << "  {\"view\": \"" << r.view << "\", \"container\": \"" << r.container
+        << "\", \"size\": " << r.size << ", \"scenario\": \"" << r.scenario
+        << "\", \"lib\": \"" << r.lib << "\", \"ns\": " << r.ns
+        << ", \"ns_per_elem\": " << r.ns / double(elems) << '}'
+        << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  out << "]\n";
+}
+
+int main(int argc, char* argv[])
+{
+  std::string basename = argc > 1 ? argv[1] : "belleviews_bench";
+
+  std::vector<Result> results;
+  for (int size : {1'000, 100'000, 1'000'000}) {
+    std::cout << "\n==== " << size << " elements:\n";
+    benchAllViews<std::vector<int>>(results, "vector", size);
+    benchAllViews<std::list<int>>(results, "list", size);
+    benchAllViews<std::deque<int>>(results, "deque", size);
+  }
+
+  writeCSV(basename + ".csv", results);
+  writeJSON(basename + ".json", results);
+  std::cout << "\nresults written to " << basename << ".csv and " << basename << ".json\n";
+}
@@ -0,0 +1,101 @@
+#!/bin/sh
+#
+# codegencheck.sh
+#
+# Codegen regression test for the kernels in codegenkernels.cpp:
+# disassembles the object file and compares each belle kernel (bel_xxx, cbel_xxx)
+# with its hand-written counterpart (hand_xxx):
+# - if the hand-written loop is vectorized, the belle loop has to be vectorized too
+# - the hot loop (the smallest loop using packed instructions, otherwise the smallest loop)
+#   must not have more instructions than the hand-written one
+# - the whole function must not have more than 1.5 times the instructions of the hand-written one
+#
+# usage: codegencheck.sh codegenkernels.o [objdump]
+#   e.g.: g++ --std=c++20 -O3 -c codegenkernels.cpp && ./codegencheck.sh codegenkernels.o
+
+OBJ=$1
+OBJDUMP=${2:-objdump}
+
+if [ -z "$OBJ" ]; then
+  echo "usage: $0 codegenkernels.o [objdump]" >&2
+  exit 2
+fi
+
+"$OBJDUMP" -d --no-show-raw-insn "$OBJ" | awk '
+# per function: number of instructions, whether any packed instruction is used,
+# and the size of the hot loop (loops are found by backward jumps)
+/^[0-9a-f]+ <.*>:$/ {
+  name = $2; gsub(/[<>:]/, "", name)
+  n = 0
+  funcs[name] = 1
+  order[++numFuncs] = name
+  next
+}
+/^ +[0-9a-f]+:/ {
+  addr = $1; sub(/:$/, "", addr)
+  ++n
+  idx[name, addr] = n
+  # packed integer (p...) or floating-point (...ps/...pd) instructions on vector registers:
+  isPacked[name, n] = ($0 ~ /%[xyz]mm/ && ($2 ~ /^v?p/ || $2 ~ /p[sd]$/))
+  if (isPacked[name, n]) {
+    vectorized[name] = 1
+  }
+  insns[name] = n
+  if ($2 ~ /^j/ && (name, $3) in idx) {
+    start = idx[name, $3]
+    size = n - start + 1
+    packed = 0
+    for (i = start; i <= n; ++i) {
+      packed += isPacked[name, i]
+    }
+    if (packed > 0 && (!((name) in vecLoop) || size < vecLoop[name])) {
+      vecLoop[name] = size
+    }
+    if (!((name) in anyLoop) || size < anyLoop[name]) {
+      anyLoop[name] = size
+    }
+  }
+}
+function hotLoop(f) {
+  return (f in vecLoop) ? vecLoop[f] : ((f in anyLoop) ? anyLoop[f] : 0)
+}
+END {
+  failed = 0
+  numChecked = 0
+  printf "%-18s %6s %6s %10s\n", "kernel", "insns", "loop", "vectorized"
+  for (k = 1; k <= numFuncs; ++k) {
+    f = order[k]
+    if (f !~ /^c?bel_/) {
+      continue
+    }
+    hand = f; sub(/^c?bel_/, "hand_", hand)
+    if (!(hand in funcs)) {
+      print "TEST FAILED: no hand-written kernel " hand " for " f
+      failed = 1
+      continue
+    }
+    ++numChecked
+    if (!(hand in printed)) {
+      printf "%-18s %6d %6d %10s\n", hand, insns[hand], hotLoop(hand), (hand in vectorized) ? "yes" : "no"
+      printed[hand] = 1
+    }
+    printf "%-18s %6d %6d %10s\n", f, insns[f], hotLoop(f), (f in vectorized) ? "yes" : "no"
+    if ((hand in vectorized) && !(f in vectorized)) {
+      print "TEST FAILED: " f " is not vectorized (but " hand " is)"
+      failed = 1
+    }
+    if (hotLoop(f) > hotLoop(hand)) {
+      print "TEST FAILED: hot loop of " f " has more instructions than the one of " hand
+      failed = 1
+    }
+    if (insns[f] > 1.5 * insns[hand]) {
+      print "TEST FAILED: " f " has far more instructions than " hand
+      failed = 1
+    }
+  }
+  if (numChecked == 0) {
+    print "TEST FAILED: no kernels found"
+    failed = 1
+  }
+  exit failed
+}'
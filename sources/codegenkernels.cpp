@@ -0,0 +1,205 @@
+#include <vector>
+#include <cstddef>
+#include "belleviews.hpp"
+#include "belletransform.hpp"
+
+//**********************************************************************
+// Kernels for the codegen regression test (see codegencheck.sh):
+// - each hand-written kernel hand_xxx has belle counterparts bel_xxx
+//   and cbel_xxx (iterating over the const view)
+// - the inner loops of all of them should compile to the same code
+//   (same vectorization, about the same number of instructions)
+// - extern "C" to find them easily in the output of objdump
+//**********************************************************************
+
+auto times2 = [] (int i) { return i * 2; };
+
+extern "C" {
+
+//**** sum of all elements:
+int hand_all(const std::vector<int>& v)
+{
+  int sum = 0;
+  const int* end = v.data() + v.size();
+  for (const int* p = v.data(); p != end; ++p) {
+    sum += *p;
+  }
+  return sum;
+}
+
+int bel_all(std::vector<int>& v)
+{
+  int sum = 0;
+  for (int i : bel::views::all(v)) {
+    sum += i;
+  }
+  return sum;
+}
+
+int cbel_all(std::vector<int>& v)
+{
+  int sum = 0;
+  const auto vw = bel::views::all(v);
+  for (int i : vw) {
+    sum += i;
+  }
+  return sum;
+}
+
+//**** sum of the first n elements:
+int hand_take(const std::vector<int>& v, std::size_t n)
+{
+  int sum = 0;
+  const int* end = v.data() + (n < v.size() ? n : v.size());
+  for (const int* p = v.data(); p != end; ++p) {
+    sum += *p;
+  }
+  return sum;
+}
+
+int bel_take(std::vector<int>& v, std::size_t n)
+{
+  int sum = 0;
+  for (int i : v | bel::views::take(static_cast<std::ptrdiff_t>(n))) {
+    sum += i;
+  }
+  return sum;
+}
+
+int cbel_take(std::vector<int>& v, std::size_t n)
+{
+  int sum = 0;
+  const auto vw = v | bel::views::take(static_cast<std::ptrdiff_t>(n));
+  for (int i : vw) {
+    sum += i;
+  }
+  return sum;
+}
+
+//**** sum of all but the first n elements:
+int hand_drop(const std::vector<int>& v, std::size_t n)
+{
+  int sum = 0;
+  const int* end = v.data() + v.size();
+  for (const int* p = v.data() + (n < v.size() ? n : v.size()); p != end; ++p) {
+    sum += *p;
+  }
+  return sum;
+}
+
+int bel_drop(std::vector<int>& v, std::size_t n)
+{
+  int sum = 0;
+  for (int i : v | bel::views::drop(static_cast<std::ptrdiff_t>(n))) {
+    sum += i;
+  }
+  return sum;
+}
+
+int cbel_drop(std::vector<int>& v, std::size_t n)
+{
+  int sum = 0;
+  const auto vw = v | bel::views::drop(static_cast<std::ptrdiff_t>(n));
+  for (int i : vw) {
+    sum += i;
+  }
+  return sum;
+}
+
+//**** sum of all elements doubled:
+int hand_transform(const std::vector<int>& v)
+{
+  int sum = 0;
+  const int* end = v.data() + v.size();
+  for (const int* p = v.data(); p != end; ++p) {
+    sum += *p * 2;
+  }
+  return sum;
+}
+
+int bel_transform(std::vector<int>& v)
+{
+  int sum = 0;
+  for (int i : v | bel::views::transform(times2)) {
+    sum += i;
+  }
+  return sum;
+}
+
+int cbel_transform(std::vector<int>& v)
+{
+  int sum = 0;
+  const auto vw = v | bel::views::transform(times2);
+  for (int i : vw) {
+    sum += i;
+  }
+  return sum;
+}
+
+//**** sum of the doubled elements of a sub range:
+int hand_pipeline(const std::vector<int>& v, std::size_t n)
+{
+  int sum = 0;
+  std::size_t beg = 1 < v.size() ? 1 : v.size();
+  std::size_t end = beg + n < v.size() ? beg + n : v.size();
+  for (const int* p = v.data() + beg; p != v.data() + end; ++p) {
+    sum += *p * 2;
+  }
+  return sum;
+}
+
+int bel_pipeline(std::vector<int>& v, std::size_t n)
+{
+  int sum = 0;
+  for (int i : v | bel::views::drop(1)
+                 | bel::views::take(static_cast<std::ptrdiff_t>(n))
+                 | bel::views::transform(times2)) {
+    sum += i;
+  }
+  return sum;
+}
+
+int cbel_pipeline(std::vector<int>& v, std::size_t n)
+{
+  int sum = 0;
+  const auto vw = v | bel::views::drop(1)
+                    | bel::views::take(static_cast<std::ptrdiff_t>(n))
+                    | bel::views::transform(times2);
+  for (int i : vw) {
+    sum += i;
+  }
+  return sum;
+}
+
+//**** sum of all elements weighted by their index:
+int hand_enumerate(const std::vector<int>& v)
+{
+  int sum = 0;
+  const int* beg = v.data();
+  const int* end = v.data() + v.size();
+  for (const int* p = beg; p != end; ++p) {
+    sum += static_cast<int>(p - beg) * *p;
+  }
+  return sum;
+}
+
+int bel_enumerate(std::vector<int>& v)
+{
+  int sum = 0;
+  for (auto [idx, i] : v | bel::views::enumerate()) {
+    sum += static_cast<int>(idx) * i;
+  }
+  return sum;
+}
+
+int cbel_enumerate(std::vector<int>& v)
+{
+  int sum = 0;
+  const auto vw = v | bel::views::enumerate();
+  for (auto [idx, i] : vw) {
+    sum += static_cast<int>(idx) * i;
+  }
+  return sum;
+}
+
+} // extern "C"
@@ -20,13 +20,13 @@ class basic_const_iterator;
 //   - false if I is a specialization of basic_const_iterator and
 //   - true otherwise.
 template<typename Iterator>
-inline constexpr bool is_not_a_const_iterator = false;
+inline constexpr bool is_basic_const_iterator = false;
 
 template<typename Iterator>
-inline constexpr bool is_not_a_const_iterator<basic_const_iterator<Iterator>> = true;
+inline constexpr bool is_basic_const_iterator<basic_const_iterator<Iterator>> = true;
 
 template <typename Iterator>
-concept NotAConstIterator = is_not_a_const_iterator<Iterator>;
+concept NotAConstIterator = !is_basic_const_iterator<Iterator>;
 
 
 // The member typedef-name iterator_category is defined if and only if Iterator models forward_iterator.
@@ -105,10 +105,10 @@ public:
     requires std::is_lvalue_reference_v<std::iter_reference_t<Iterator>> &&
              std::same_as<std::remove_cvref_t<std::iter_reference_t<Iterator>>, value_type> {
     if constexpr (std::contiguous_iterator<Iterator>) {
-      return to_address(current_);
+      return std::to_address(current_);
     }
     else {
-      std::addressof(*current_);
+      return std::addressof(*current_);
     }
   }
 
@@ -118,7 +118,7 @@ public:
     return *this;
   }
   constexpr void operator++(int) {
-    return ++current_;
+    ++current_;
   }
   constexpr basic_const_iterator operator++(int) requires std::forward_iterator<Iterator> {
     auto tmp = *this;
@@ -182,7 +182,7 @@ public:
   }
   constexpr basic_const_iterator& operator-=(difference_type n)
     requires std::random_access_iterator<Iterator> {
-      current_ += n;
+      current_ -= n;
       return *this;
   }
 
@@ -229,50 +229,53 @@ public:
       return x.current_ <=> y.current_;
   }
 
-  template<belleviews::_intern::different_from<basic_const_iterator> I>
-  friend constexpr bool operator<(const basic_const_iterator& x, const I& y)
+  // the basic_const_iterator operands are deduced and checked first so that
+  // comparing other iterators (e.g. reverse_iterator<basic_const_iterator<>>)
+  // does not check totally_ordered_with<> recursively:
+  template<std::same_as<basic_const_iterator> CI, belleviews::_intern::different_from<basic_const_iterator> I>
+  friend constexpr bool operator<(const CI& x, const I& y)
     requires std::random_access_iterator<Iterator> && std::totally_ordered_with<Iterator, I> {
       return x.current_ < y;
   }
-  template<belleviews::_intern::different_from<basic_const_iterator> I>
-  friend constexpr bool operator>(const basic_const_iterator& x, const I& y)
+  template<std::same_as<basic_const_iterator> CI, belleviews::_intern::different_from<basic_const_iterator> I>
+  friend constexpr bool operator>(const CI& x, const I& y)
     requires std::random_access_iterator<Iterator> && std::totally_ordered_with<Iterator, I> {
-      return x.current_ > y.current_;
+      return x.current_ > y;
   }
-  template<belleviews::_intern::different_from<basic_const_iterator> I>
-  friend constexpr bool operator<=(const basic_const_iterator& x, const I& y)
+  template<std::same_as<basic_const_iterator> CI, belleviews::_intern::different_from<basic_const_iterator> I>
+  friend constexpr bool operator<=(const CI& x, const I& y)
   requires std::random_access_iterator<Iterator> && std::totally_ordered_with<Iterator, I> {
       return x.current_ <= y;
   }
-  template<belleviews::_intern::different_from<basic_const_iterator> I>
-  friend constexpr bool operator>=(const basic_const_iterator& x, const I& y)
+  template<std::same_as<basic_const_iterator> CI, belleviews::_intern::different_from<basic_const_iterator> I>
+  friend constexpr bool operator>=(const CI& x, const I& y)
   requires std::random_access_iterator<Iterator> && std::totally_ordered_with<Iterator, I> {
       return x.current_ >= y;
   }
-  template<belleviews::_intern::different_from<basic_const_iterator> I>
-  friend constexpr auto operator<=>(const basic_const_iterator& x, const I& y)
+  template<std::same_as<basic_const_iterator> CI, belleviews::_intern::different_from<basic_const_iterator> I>
+  friend constexpr auto operator<=>(const CI& x, const I& y)
   requires std::random_access_iterator<Iterator> && std::totally_ordered_with<Iterator, I> &&
            std::three_way_comparable_with<Iterator, I> {
       return x.current_ <=> y;
   }
 
-  template<belleviews::_intern::NotAConstIterator I>
-  friend constexpr bool operator<(const I& x, const basic_const_iterator& y)
+  template<belleviews::_intern::NotAConstIterator I, std::same_as<basic_const_iterator> CI>
+  friend constexpr bool operator<(const I& x, const CI& y)
   requires std::random_access_iterator<Iterator> && std::totally_ordered_with<Iterator, I> {
       return x < y.current_;
   }
-  template<belleviews::_intern::NotAConstIterator I>
-  friend constexpr bool operator>(const I& x, const basic_const_iterator& y)
+  template<belleviews::_intern::NotAConstIterator I, std::same_as<basic_const_iterator> CI>
+  friend constexpr bool operator>(const I& x, const CI& y)
   requires std::random_access_iterator<Iterator> && std::totally_ordered_with<Iterator, I> {
       return x > y.current_;
   }
-  template<belleviews::_intern::NotAConstIterator I>
-  friend constexpr bool operator<=(const I& x, const basic_const_iterator& y)
+  template<belleviews::_intern::NotAConstIterator I, std::same_as<basic_const_iterator> CI>
+  friend constexpr bool operator<=(const I& x, const CI& y)
   requires std::random_access_iterator<Iterator> && std::totally_ordered_with<Iterator, I> {
       return x <= y.current_;
   }
-  template<belleviews::_intern::NotAConstIterator I>
-  friend constexpr bool operator>=(const I& x, const basic_const_iterator& y)
+  template<belleviews::_intern::NotAConstIterator I, std::same_as<basic_const_iterator> CI>
+  friend constexpr bool operator>=(const I& x, const CI& y)
   requires std::random_access_iterator<Iterator> && std::totally_ordered_with<Iterator, I> {
       return x >= y.current_;
   }
@@ -283,23 +286,63 @@ public:
 
 // **** According to C++23:
 
+// contiguous_const_counterpart:
+// For contiguous iterators the standard library itself has a const counterpart
+// (T* => const T*, vector<T>::iterator => vector<T>::const_iterator).
+// Using it instead of basic_const_iterator<> keeps const views on contiguous memory
+// on the fast paths of the standard algorithms (memmove() for copy() etc.).
+// The iterator always converts implicitly to its const counterpart.
+template<typename It>
+struct contiguous_const_counterpart {
+};
+
+template<typename T>
+requires std::is_object_v<T>
+struct contiguous_const_counterpart<T*> {
+  using type = const T*;
+};
+
+#ifdef __GLIBCXX__
+template<typename T, typename Cont>
+requires std::is_object_v<T>
+struct contiguous_const_counterpart<__gnu_cxx::__normal_iterator<T*, Cont>> {
+  using type = __gnu_cxx::__normal_iterator<const T*, Cont>;
+};
+#endif
+
+template<typename It>
+concept HasContiguousConstCounterpart = requires { typename contiguous_const_counterpart<It>::type; };
+
+
 // template<std::input_iterator I>
 // using const_iterator = see below ;
 //   Result: If I models constant-iterator, I. Otherwise, basic_const_iterator<I>.
+// Deviations:
+// - If I has a contiguous const counterpart (see above), that type.
+// - A basic_const_iterator is never wrapped again
+//   (even if for some proxy reference it doesn't model constant-iterator).
+// The types are computed by partial specializations only
+// so that no function bodies have to be instantiated to get them.
 
-template <std::input_iterator It>
-constexpr auto MakeConstIterator(It it)
-{
-  if constexpr (ConstantIterator<It>) {
-      return it;
-  }
-  else {
-      return basic_const_iterator<It>(it);
-  }
-}
+template<std::input_iterator It>
+struct ConstIteratorTrait {
+  using type = basic_const_iterator<It>;
+};
+
+template<std::input_iterator It>
+requires (ConstantIterator<It> || is_basic_const_iterator<It>)
+struct ConstIteratorTrait<It> {
+  using type = It;
+};
+
+template<std::input_iterator It>
+requires (!ConstantIterator<It> && HasContiguousConstCounterpart<It>)
+struct ConstIteratorTrait<It> {
+  using type = typename contiguous_const_counterpart<It>::type;
+};
 
 template<std::input_iterator It>
-using const_iterator = decltype(belleviews::_intern::MakeConstIterator(std::declval<It>()));
+using const_iterator = typename ConstIteratorTrait<It>::type;
 
 template<std::input_iterator I>
 constexpr const_iterator<I> make_const_iterator(I it)
@@ -311,19 +354,18 @@ constexpr const_iterator<I> make_const_iterator(I it)
 // using const_sentinel = see below ;
 //   Result: If S models input_iterator, const_iterator<S>. Otherwise, S.
 
-template <typename S>
-constexpr auto MakeConstSentinel(S s)
-{
-  if constexpr (std::input_iterator<S>) {
-    return const_iterator<S>(s);
-  }
-  else {
-    return s;
-  }
-}
+template<typename S>
+struct ConstSentinelTrait {
+  using type = S;
+};
+
+template<std::input_iterator S>
+struct ConstSentinelTrait<S> {
+  using type = const_iterator<S>;
+};
 
 template<typename S>
-using const_sentinel = decltype(belleviews::_intern::MakeConstSentinel(std::declval<S>()));
+using const_sentinel = typename ConstSentinelTrait<S>::type;
 
 template<typename S>
 constexpr const_sentinel<S> make_const_sentinel(S s)
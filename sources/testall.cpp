@@ -94,6 +94,44 @@ int main()
   print(arr_bel_cref_own);
   
 
+  // **** test contiguity of const views:
+  {
+    std::vector vec{1, 2, 3, 4, 5, 6, 7, 8};
+    const auto& vec_bel_cref = bel::views::all(vec);
+    static_assert(std::ranges::contiguous_range<decltype(vec_bel_cref)>);
+    static_assert(std::is_const_v<std::remove_reference_t<decltype(*vec_bel_cref.begin())>>);
+    static_assert(std::same_as<decltype(vec_bel_cref.data()), const int*>);
+
+    const auto& vec_bel_cref_drop = vec | bel::views::drop(2);
+    static_assert(std::ranges::contiguous_range<decltype(vec_bel_cref_drop)>);
+    static_assert(std::same_as<decltype(vec_bel_cref_drop.data()), const int*>);
+    if (vec_bel_cref_drop.data() != vec.data() + 2) {
+      std::cerr << "TEST FAILED: data() of const drop view\n";
+    }
+
+    const auto& ptr_bel_cref = bel::views::sub(vec.data(), vec.data() + 4);
+    static_assert(std::same_as<std::ranges::iterator_t<decltype(ptr_bel_cref)>, const int*>);
+    print(ptr_bel_cref);
+  }
+
+  // **** test that const iterators are never wrapped twice:
+  {
+    using ConstListIter = decltype(std::make_const_iterator(coll.begin()));
+    static_assert(std::same_as<decltype(std::make_const_iterator(std::declval<ConstListIter>())),
+                               ConstListIter>);
+    static_assert(std::same_as<decltype(std::make_const_sentinel(std::declval<ConstListIter>())),
+                               ConstListIter>);
+
+    auto lessThan0 = [](int i) { return i < 0; };
+    const auto& lst_bel_deep1 = coll | bel::views::drop(1);
+    const auto& lst_bel_deep6 = coll | bel::views::drop(1) | bel::views::drop_while(lessThan0)
+                                     | bel::views::drop(1) | bel::views::drop_while(lessThan0)
+                                     | bel::views::drop(1) | bel::views::drop(1);
+    static_assert(std::same_as<std::ranges::iterator_t<decltype(lst_bel_deep6)>,
+                               std::ranges::iterator_t<decltype(lst_bel_deep1)>>);
+    print(lst_bel_deep6);
+  }
+
   // test common:
 
   // test sentinels:
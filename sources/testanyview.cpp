@@ -0,0 +1,103 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <array>
+#include <string>
+#include <thread>
+#include <numeric>
+#include <ranges>
+#include "belleviews.hpp"
+#include "belletransform.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+// no template: any pipeline with elements convertible to int can be passed:
+long sum(const bel::any_view<int>& vw)
+{
+  long s = 0;
+  for (int i : vw) {
+    s += i;
+  }
+  return s;
+}
+
+std::string concat(bel::any_const_view<std::string> vw)
+{
+  std::string s;
+  for (const auto& elem : vw) {
+    s += elem;
+  }
+  return s;
+}
+
+
+int main()
+{
+  std::vector<int> vec(1000);
+  std::iota(vec.begin(), vec.end(), 1);
+  std::list<int> lst{1, 2, 3, 4, 5, 6, 7, 8};
+
+  // different pipelines, one function:
+  check(sum(vec) == 500'500, "any_view of vector");
+  check(sum(vec | bel::views::drop(500)) == 375'250, "any_view of drop (more than one block)");
+  check(sum(lst | bel::views::filter([] (int i) { return i % 2 == 0; })) == 20, "any_view of filter");
+  check(sum(lst | bel::views::transform([] (int i) { return i * i; })) == 204, "any_view of transform");
+  check(sum(std::vector{1, 2, 3}) == 6, "any_view owning a temporary");
+  check(sum(vec | bel::views::take(0)) == 0, "empty any_view");
+  check(sum(bel::any_view<int>{}) == 0, "default constructed any_view");
+
+  // small and large views:
+  auto large = [big = std::array<long, 16>{}] (int i) { return i + big[0]; };
+  check(sum(lst | bel::views::transform(large)) == 36, "any_view of a large view (on the heap)");
+
+  std::vector<std::string> words{"hello", " ", "world"};
+  check(concat(words) == "hello world", "any_const_view");
+  check(concat(words | bel::views::take(1)) == "hello", "any_const_view of take");
+
+  // read-only (the elements are copies):
+  bel::any_view<int> av{vec | bel::views::take(3)};
+  const bel::any_view<int>& cav = av;
+  static_assert(!SupportsAssign<decltype(*av.begin()), int>);
+  static_assert(!SupportsAssign<decltype(*cav.begin()), int>);
+  bel::any_const_view<int> acv{vec};
+  static_assert(!SupportsAssign<decltype(*acv.begin()), int>);
+  static_assert(std::ranges::input_range<decltype(cav)>);
+  static_assert(std::ranges::view<decltype(av)>);
+
+  // views that are not const-iterable (const any_views iterate over a copy):
+  auto isEven = [] (int i) { return i % 2 == 0; };
+  bel::any_view<int> avStdFilter{lst | std::views::filter(isEven)};
+  check(sum(avStdFilter) == 20, "const any_view of std::views::filter");
+  long sumStdFilter = 0;
+  for (int i : avStdFilter) {
+    sumStdFilter += i;
+  }
+  check(sumStdFilter == 20, "any_view of std::views::filter");
+  static_assert(!std::constructible_from<bel::any_const_view<int>,
+                                         decltype(lst | std::views::filter(isEven))>);
+
+  // moving:
+  bel::any_view<int> av2{std::move(av)};
+  print(av2);
+
+  // concurrent iterations of the const view:
+  long s1 = 0, s2 = 0;
+  bel::any_view<int> avAll{vec};
+  const auto& cavAll = avAll;
+  {
+    std::jthread t1{[&] { s1 = sum(cavAll); }};
+    std::jthread t2{[&] { s2 = sum(cavAll); }};
+  }
+  check(s1 == 500'500 && s2 == 500'500, "concurrent iterations");
+}
@@ -0,0 +1,155 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <numeric>
+#include <algorithm>
+#include <ranges>
+#include "belleviews.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+void testBasics()
+{
+  std::list<int> coll{1, 2, 3, 4, 5, 6, 7, 8};
+
+  // predicate calls show how often begin() is computed:
+  std::atomic<int> numCalls = 0;
+  auto isEven = [&numCalls] (int i) { ++numCalls; return i % 2 == 0; };
+
+  auto vw = coll | bel::views::filter(isEven) | bel::views::cache_begin();
+  check(numCalls == 0, "begin() not computed on construction");
+  print(vw);
+  int callsFirst = numCalls;
+  print(vw);
+  // (finding begin() calls the predicate for 1 and 2):
+  check(numCalls - callsFirst == callsFirst - 2, "begin() computed only once");
+
+  // const views compute (and use) the cache too:
+  const auto cvw = coll | bel::views::drop(3) | bel::views::cache_begin();
+  print(cvw);
+  check(*cvw.begin() == 4, "begin() const");
+  static_assert(!SupportsAssign<decltype(*cvw.begin()), int>);
+  static_assert(SupportsAssign<decltype(*vw.begin()), int>);
+
+  // copies compute their own begin():
+  auto vw2 = vw;
+  numCalls = 0;
+  check(*vw2.begin() == 2 && numCalls == 2, "copy computes begin() again");
+
+  // borrowed if the underlying range is borrowed:
+  static_assert(std::ranges::borrowed_range<decltype(cvw)>);
+  static_assert(!std::ranges::borrowed_range<decltype(vw)>);
+}
+
+
+void testConcurrency()
+{
+  std::list<int> coll(10'000);
+  std::iota(coll.begin(), coll.end(), 0);
+
+  std::atomic<int> numCalls = 0;
+  auto isLarge = [&numCalls] (int i) { ++numCalls; return i >= 9'000; };
+  const auto vw = coll | bel::views::filter(isLarge) | bel::views::cache_begin();
+
+  // many threads iterate concurrently over the const view:
+  std::vector<long> sums(8);
+  {
+    std::vector<std::jthread> threads;
+    for (std::size_t t = 0; t < sums.size(); ++t) {
+      threads.emplace_back([&, t] {
+                             auto pos = vw.begin();
+                             sums[t] = *pos;
+                           });
+    }
+  }
+  for (long s : sums) {
+    check(s == 9'000, "concurrent begin() const");
+  }
+  check(numCalls == 9'001, "concurrent begin() computed only once");
+}
+
+
+void testConstEnd()
+{
+  std::list<int> coll(1'000);
+  std::iota(coll.begin(), coll.end(), 0);
+
+  // end() const and size() const don't race with computing begin():
+  const auto vwTake = coll | bel::views::take(500) | bel::views::cache_begin();
+  auto isEven = [] (int i) { return i % 2 == 0; };
+  const auto vwStdFilter = coll | std::views::filter(isEven) | bel::views::cache_begin();
+  const auto vwIota = std::views::iota(0) | std::views::take(1'000) | bel::views::cache_begin();
+  std::vector<long> sums(8);
+  {
+    std::vector<std::jthread> threads;
+    for (std::size_t t = 0; t < sums.size(); ++t) {
+      threads.emplace_back([&, t] {
+                             long sum = static_cast<long>(vwTake.size());
+                             for (int i : vwTake) sum += i;
+                             for (int i : vwStdFilter) sum += i;
+                             for (int i : vwIota) sum += i;
+                             sums[t] = sum;
+                           });
+    }
+  }
+  for (long s : sums) {
+    check(s == 500 + 124'750 + 249'500 + 499'500, "concurrent const iterations up to end()");
+  }
+}
+
+
+int numStale = 0;
+void countStale(const char*)
+{
+  ++numStale;
+}
+
+void testStale()
+{
+  belleviews::set_stale_begin_handler(countStale);
+  std::vector<int> coll{1, 2, 3, 4};
+  const auto vw = coll | bel::views::drop(1) | bel::views::cache_begin();
+  check(*vw.begin() == 2, "begin() cached");
+
+  // a stale begin is recomputed and cached again:
+  coll.insert(coll.begin(), 0);
+  check(*vw.begin() == 1 && numStale == 1, "stale begin() recomputed");
+  check(*vw.begin() == 1 && numStale == 1, "recomputed begin() cached");
+
+  // concurrent iterations after the modification recompute the begin only once:
+  coll.insert(coll.begin(), -1);
+  std::vector<int> firsts(8);
+  {
+    std::vector<std::jthread> threads;
+    for (std::size_t t = 0; t < firsts.size(); ++t) {
+      threads.emplace_back([&, t] { firsts[t] = *vw.begin(); });
+    }
+  }
+  check(std::ranges::count(firsts, 0) == 8, "concurrent begin() after modification");
+  check(numStale == 2, "concurrent stale begin() recomputed once");
+  belleviews::set_stale_begin_handler(nullptr);
+}
+
+
+int main()
+{
+  testBasics();
+  testConcurrency();
+  testConstEnd();
+  testStale();
+}
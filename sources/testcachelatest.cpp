@@ -0,0 +1,141 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <ranges>
+#include "belleviews.hpp"
+#include "belletransform.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+void testBasics()
+{
+  std::vector<int> coll{1, 2, 3, 4, 5, 6, 7, 8};
+
+  // function calls show how often elements are transformed:
+  std::atomic<int> numCalls = 0;
+  auto square = [&numCalls] (int i) { ++numCalls; return i * i; };
+  auto isEven = [] (int i) { return i % 2 == 0; };
+
+  // without caching, filter transforms the elements it yields twice:
+  print(coll | bel::views::transform(square) | bel::views::filter(isEven));
+  check(numCalls == 8 + 4, "transform | filter transforms twice");
+
+  numCalls = 0;
+  auto vw = coll | bel::views::transform(square)
+                 | bel::views::cache_latest()
+                 | bel::views::filter(isEven);
+  print(vw);
+  check(numCalls == 8, "transform | cache_latest | filter transforms once");
+
+  // const views can iterate too (and propagate const):
+  numCalls = 0;
+  const auto cvw = coll | bel::views::transform(square) | bel::views::cache_latest();
+  print(cvw);
+  check(numCalls == 8, "const iteration");
+
+  // references are not copied:
+  auto vwRef = coll | bel::views::cache_latest();
+  *vwRef.begin() = 42;
+  check(coll[0] == 42, "modify via reference");
+  const auto& cvwRef = vwRef;
+  static_assert(!SupportsAssign<decltype(*cvwRef.begin()), int>);
+
+  static_assert(std::ranges::input_range<decltype(vw)>);
+  static_assert(std::ranges::sized_range<decltype(vwRef)>);
+  static_assert(std::ranges::borrowed_range<decltype(vwRef)>);
+}
+
+
+void testConcurrency()
+{
+  std::list<int> coll;
+  for (int i = 0; i < 10'000; ++i) {
+    coll.push_back(i);
+  }
+  auto isMultipleOf3 = [] (long i) { return i % 3 == 0; };
+  const auto vw = coll | bel::views::transform([] (int i) { return long{i} * i; })
+                       | bel::views::cache_latest()
+                       | bel::views::filter(isMultipleOf3);
+
+  // each thread has its own iterator and therefore its own cache:
+  std::vector<long> sums(4);
+  {
+    std::vector<std::jthread> threads;
+    for (std::size_t t = 0; t < sums.size(); ++t) {
+      threads.emplace_back([&, t] {
+                             for (long v : vw) {
+                               sums[t] += v;
+                             }
+                           });
+    }
+  }
+  for (long s : sums) {
+    check(s == sums[0] && s > 0, "concurrent iterations");
+  }
+}
+
+
+void testClassTypes()
+{
+  std::vector<int> coll{1, 22, 333, 4444};
+
+  // dereferencing twice yields the same (not a moved-away) string:
+  std::atomic<int> numCalls = 0;
+  auto toString = [&numCalls] (int i) { ++numCalls; return std::to_string(i); };
+  auto vw = coll | bel::views::transform(toString) | bel::views::cache_latest();
+  auto pos = vw.begin();
+  std::string s1 = *pos;
+  std::string s2 = *pos;
+  check(s1 == "1" && s2 == "1" && numCalls == 1, "dereference strings twice");
+  static_assert(std::same_as<decltype(*pos), std::string&>);
+
+  // filter dereferences twice:
+  numCalls = 0;
+  auto isLong = [] (const std::string& s) { return s.size() > 2; };
+  auto vwFilter = coll | bel::views::transform(toString)
+                       | bel::views::cache_latest()
+                       | bel::views::filter(isLong);
+  std::vector<std::string> result;
+  for (const auto& s : vwFilter) {
+    result.push_back(s);
+  }
+  check(result == std::vector<std::string>{"333", "4444"}, "transform | cache_latest | filter with strings");
+  check(numCalls == 4, "strings transformed only once");
+
+  // transformations yielding const values:
+  auto toConstString = [] (int i) -> const std::string { return std::to_string(i); };
+  const auto cvw = coll | bel::views::transform(toConstString) | bel::views::cache_latest();
+  auto cpos = cvw.begin();
+  check(*cpos == "1" && *cpos == "1", "const view of const strings");
+  static_assert(std::same_as<decltype(*cpos), const std::string&>);
+  std::vector<std::string> result2;
+  for (const auto& s : coll | bel::views::transform(toConstString)
+                            | bel::views::cache_latest()
+                            | bel::views::filter(isLong)) {
+    result2.push_back(s);
+  }
+  check(result2 == result, "transform | cache_latest | filter with const strings");
+}
+
+
+int main()
+{
+  testBasics();
+  testConcurrency();
+  testClassTypes();
+}
@@ -0,0 +1,148 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <deque>
+#include <span>
+#include <string>
+#include <thread>
+#include <numeric>
+#include <ranges>
+#include "belleviews.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& chunk : coll) {
+    std::cout << "[ ";
+    for (const auto& elem : chunk) {
+      std::cout << elem << ' ';
+    }
+    std::cout << "] ";
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+void testContiguous()
+{
+  std::vector<int> coll{1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+
+  auto vw = coll | bel::views::chunk(4);
+  print(vw);
+  check(vw.size() == 3, "number of chunks");
+  check(std::ranges::distance(vw) == 3, "number of chunks iterated");
+  check(vw[2].size() == 2 && vw[2][1] == 10, "last chunk is smaller");
+
+  // chunks are spans of raw memory:
+  static_assert(std::same_as<std::ranges::range_value_t<decltype(vw)>, std::span<int>>);
+  check(vw[1].data() == coll.data() + 4, "chunk refers to raw memory");
+  for (auto chunk : vw) {
+    chunk[0] = 0;
+  }
+  check(coll[0] == 0 && coll[4] == 0 && coll[8] == 0, "modify elements via chunks");
+
+  // const views yield spans of const elements:
+  const auto cvw = coll | bel::views::chunk(4);
+  static_assert(std::same_as<std::ranges::range_value_t<decltype(cvw)>, std::span<const int>>);
+  static_assert(!SupportsAssign<decltype((*cvw.begin())[0]), int>);
+
+  static_assert(std::ranges::random_access_range<decltype(vw)>);
+  static_assert(std::ranges::random_access_range<decltype(cvw)>);
+  static_assert(std::ranges::borrowed_range<decltype(vw)>);
+
+  // iterating backward:
+  auto last = std::ranges::next(vw.begin(), vw.end());
+  --last;
+  check((*last).size() == 2 && (*last)[1] == 10, "backward iteration to the last chunk");
+  --last;
+  check((*last).size() == 4 && (*last)[0] == 0 && (*last)[1] == 6, "backward iteration");
+  check(vw.end() - vw.begin() == 3, "iterator difference");
+
+  // chunk size exactly divides the size:
+  check((coll | bel::views::chunk(5)).size() == 2, "exact chunks");
+  check((coll | bel::views::chunk(20)).size() == 1, "one chunk");
+  check(std::ranges::empty(std::vector<int>{} | bel::views::chunk(3)), "no chunk");
+}
+
+
+void testNonContiguous()
+{
+  // random-access ranges yield subranges of two iterators:
+  std::deque<int> deq{1, 2, 3, 4, 5, 6, 7};
+  auto vwDeq = deq | bel::views::chunk(3);
+  print(vwDeq);
+  check(vwDeq.size() == 3 && vwDeq[2].size() == 1, "deque chunks");
+  const auto cvwDeq = deq | bel::views::chunk(3);
+  static_assert(!SupportsAssign<decltype(*(*cvwDeq.begin()).begin()), int>);
+
+  // other forward ranges yield take_views:
+  std::list<int> lst{1, 2, 3, 4, 5, 6, 7};
+  auto vwLst = lst | bel::views::chunk(3);
+  print(vwLst);
+  check(vwLst.size() == 3, "number of list chunks in O(1)");
+  int sum = 0;
+  int numChunks = 0;
+  for (const auto& chunk : vwLst) {
+    ++numChunks;
+    for (int i : chunk) {
+      sum += i;
+    }
+  }
+  check(numChunks == 3 && sum == 28, "list chunks");
+  static_assert(std::ranges::bidirectional_range<decltype(vwLst)>);
+  const auto cvwLst = lst | bel::views::chunk(3);
+  static_assert(!SupportsAssign<decltype(*(*cvwLst.begin()).begin()), int>);
+  static_assert(SupportsAssign<decltype(*(*vwLst.begin()).begin()), int>);
+
+  // in pipelines:
+  auto vwPipe = lst | bel::views::filter([](int i) { return i % 2 == 1; })
+                    | bel::views::chunk(2);
+  print(vwPipe);
+  check(std::ranges::distance(vwPipe) == 2, "chunks of filtered elements");
+}
+
+
+void testConcurrency()
+{
+  std::vector<long> coll(100'000);
+  std::iota(coll.begin(), coll.end(), 0);
+
+  // many threads process the chunks of the const view concurrently:
+  const auto vw = coll | bel::views::chunk(4096);
+  std::vector<long> sums(vw.size());
+  {
+    std::vector<std::jthread> threads;
+    for (std::size_t t = 0; t < sums.size(); ++t) {
+      threads.emplace_back([&, t] {
+                             auto chunk = vw[t];
+                             sums[t] = std::accumulate(chunk.begin(), chunk.end(), 0L);
+                           });
+    }
+  }
+  check(std::accumulate(sums.begin(), sums.end(), 0L) == 99'999L * 100'000 / 2,
+        "concurrent processing of chunks");
+}
+
+
+void testNonConstIterableBase()
+{
+  // underlying views that are not const-iterable (only the non-const view is usable):
+  std::vector<int> coll{1, 2, 3, 4, 5, 6, 7};
+  auto stdFilter = coll | std::views::filter([] (int i) { return i > 1; });
+  auto vw = stdFilter | bel::views::chunk(2);
+  static_assert(!std::ranges::range<const decltype(vw)>);
+  check(std::ranges::distance(vw) == 3 && *(*vw.begin()).begin() == 2, "chunk over non-const-iterable views");
+}
+
+
+int main()
+{
+  testContiguous();
+  testNonContiguous();
+  testConcurrency();
+  testNonConstIterableBase();
+}
@@ -0,0 +1,122 @@
+#include <iostream>
+#include <vector>
+#include <deque>
+#include <list>
+#include <array>
+#include <span>
+#include <string>
+#include <thread>
+#include <ranges>
+#include "belleviews.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+void testConcat()
+{
+  // persisted head and in-memory tail:
+  std::deque<int> head{1, 2, 3};
+  std::vector<int> empty;
+  std::list<int> tail{4, 5};
+
+  auto vw = bel::views::concat(head, empty, tail);
+  print(vw);
+  check(vw.size() == 5, "size()");
+  check(std::ranges::distance(vw) == 5, "number of elements (empty ranges skipped)");
+  check(std::ranges::equal(vw, std::vector{1, 2, 3, 4, 5}), "elements");
+  static_assert(std::ranges::bidirectional_range<decltype(vw)>);
+  static_assert(std::ranges::common_range<decltype(vw)>);
+  check(std::ranges::equal(vw | std::views::reverse, std::vector{5, 4, 3, 2, 1}), "backward");
+
+  // modify the elements:
+  for (int& i : vw) {
+    i *= 10;
+  }
+  check(head[0] == 10 && tail.back() == 50, "modify elements");
+
+  // propagates const (also for ranges with shallow const such as spans):
+  std::vector<int> v{6, 7};
+  const auto cvw = bel::views::concat(head, std::span{v});
+  static_assert(!SupportsAssign<decltype(*cvw.begin()), int>);
+  static_assert(SupportsAssign<decltype(*vw.begin()), int>);
+  check(std::ranges::distance(cvw) == 5, "concat with span");
+
+  // common reference of different element types:
+  std::vector<long> longs{100};
+  auto vwMixed = bel::views::concat(head, longs);
+  static_assert(std::same_as<std::ranges::range_value_t<decltype(vwMixed)>, long>);
+  check(std::ranges::distance(vwMixed) == 4, "concat of different element types");
+
+  // in pipelines:
+  auto vwPipe = bel::views::concat(head, tail) | bel::views::filter([](int i) { return i > 20; })
+                                               | bel::views::take(2);
+  check(std::ranges::equal(vwPipe, std::vector{30, 40}), "concat in pipelines");
+}
+
+
+void testSegments()
+{
+  std::vector<int> vec{1, 2, 3};
+  std::list<int> lst{4, 5};
+  std::array<int, 2> arr{6, 7};
+  const auto vw = bel::views::concat(vec, lst, arr);
+
+  int numSegments = 0;
+  vw.for_each_segment([&](auto seg) {
+                        static_assert(!SupportsAssign<decltype(*seg.begin()), int>);
+                        ++numSegments;
+                      });
+  check(numSegments == 3, "for_each_segment()");
+
+  // algorithms dispatching per segment:
+  std::vector<int> dest(7);
+  auto end = bel::copy(vw, dest.begin());
+  check(end == dest.end() && dest == std::vector{1, 2, 3, 4, 5, 6, 7}, "bel::copy()");
+  std::vector<int> dest2;
+  bel::copy(vw, std::back_inserter(dest2));
+  check(dest2 == dest, "bel::copy() to back_inserter");
+  check(bel::reduce(vw, 0) == 28, "bel::reduce()");
+  check(bel::reduce(vw, 1L, std::multiplies<>{}) == 5040, "bel::reduce() with operation");
+  check(bel::count(vw, 5) == 1, "bel::count()");
+
+  // concat of joins:
+  std::vector<std::vector<int>> nested{{1, 2}, {}, {3}};
+  auto vwNested = bel::views::concat(nested | bel::views::join(), vec);
+  check(std::ranges::equal(vwNested, std::vector{1, 2, 3, 1, 2, 3}), "concat of join");
+  check(bel::reduce(vwNested, 0) == 12, "bel::reduce() of nested segments");
+}
+
+
+void testConcurrency()
+{
+  std::vector<int> a(10'000, 1);
+  std::deque<int> b(10'000, 2);
+  const auto vw = bel::views::concat(a, b);
+  long sum1 = 0, sum2 = 0;
+  {
+    std::jthread t{[&] {
+                     for (int i : vw) sum1 += i;
+                   }};
+    sum2 = bel::reduce(vw, 0L);
+  }
+  check(sum1 == 30'000 && sum2 == 30'000, "concurrent iterations");
+}
+
+
+int main()
+{
+  testConcat();
+  testSegments();
+  testConcurrency();
+}
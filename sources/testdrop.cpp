@@ -88,10 +88,10 @@ int main()
   //print(v6);
 
   //**** compare with std::views::drop():
-  auto v1std = std::ranges::drop_view{coll, 2};
+  [[maybe_unused]] auto v1std = std::ranges::drop_view{coll, 2};
   //print(v1std);                           // compile-time ERROR
 
-  auto v3std = coll | std::views::drop(2);
+  [[maybe_unused]] auto v3std = coll | std::views::drop(2);
   //print(v3std);                           // compile-time ERROR
 
   //auto sumUB = printAndAccum(v3std);        // runtime ERROR (undefined behavior)
@@ -189,7 +189,7 @@ int main()
     print(vec);
     const auto& vBel = vec | bel::views::drop(2);
     //vBel[0] += 42;      // ERROR
-    auto vBel2 = vBel;    // NOTE: removes constness
+    [[maybe_unused]] auto vBel2 = vBel;    // NOTE: removes constness
     //vBel2[0] += 42;       // OK
     print(vec);
   }
@@ -199,11 +199,11 @@ int main()
     std::vector vec{1, 2, 3, 4, 5, 6, 7, 8};
 
     auto vStd = vec | std::views::drop(2);
-    auto sum1 = std::reduce(std::execution::par,      // RUNTIME ERROR (possible data race)
+    [[maybe_unused]] auto sum1 = std::reduce(std::execution::par,      // RUNTIME ERROR (possible data race)
                             vStd.begin(), vStd.end(),
                             0L);
     auto vBel = vec | bel::views::drop(2);
-    auto sum2 = std::reduce(std::execution::par,      // OK
+    [[maybe_unused]] auto sum2 = std::reduce(std::execution::par,      // OK
                             vBel.begin(), vBel.end(),
                             0L);
   }
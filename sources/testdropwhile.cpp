@@ -130,6 +130,20 @@ void testBasics()
   static_assert(std::ranges::borrowed_range<decltype(vVecStd)>);
   auto vVecBel = vec | bel::views::drop_while([](const auto& s){return s[0] == 't';});
   static_assert(std::ranges::borrowed_range<decltype(vVecBel)>);
+
+  // predicates without captures need no extra space:
+  {
+    std::vector vec{1, 2, 3, 4, 5, 6, 7, 8};
+    auto vAll = bel::views::all(vec);
+    auto vDropW = vec | bel::views::drop_while(notTimes3);
+    static_assert(sizeof(vDropW) == sizeof(vAll));
+    // predicates with captures are still copy assignable:
+    int max = 5;
+    auto vDropWCap1 = vec | bel::views::drop_while([max](int i) { return i < max; });
+    auto vDropWCap2 = vDropWCap1;
+    vDropWCap2 = vDropWCap1;
+    printConst(vDropWCap2);
+  }
 }
 
 
@@ -195,7 +209,7 @@ void testConcurrentIteration()
   static_assert(!std::ranges::random_access_range<decltype(coll)>);
 
   // test concurrent read iterations:
-  auto v3Std = coll | std::views::drop_while(notTimes3);
+  [[maybe_unused]] auto v3Std = coll | std::views::drop_while(notTimes3);
   //auto sumUB = concurrentPrintAndAccum(v3std);             // RUNTIME ERROR with std views
 
   auto v3 = coll | bel::views::drop_while(notTimes3);
@@ -225,7 +239,7 @@ void testReadme()
       for (const auto& elem : vBel) {          // vBel.begin() in separate thread
         std::cout << elem << '\n';
       }}};
-    auto cnt2 = std::ranges::count_if(vBel,    // OK
+    [[maybe_unused]] auto cnt2 = std::ranges::count_if(vBel,    // OK
                                       [](int i) {return i < 0;});  
   }
 }
@@ -0,0 +1,262 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <deque>
+#include <set>
+#include <array>
+#include <span>
+#include <string>
+#include <ranges>
+#include "belleviews.hpp"
+#include "belletransform.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+int numStale = 0;
+void countStale(const char*)
+{
+  ++numStale;
+}
+
+
+void testVersioned()
+{
+  bel::versioned<std::vector<int>> coll{1, 2, 3};
+  auto gen = coll.generation();
+
+  // reading and modifying elements keeps the generation:
+  coll[0] = 42;
+  for (int& i : coll) {
+    ++i;
+  }
+  check(coll.generation() == gen, "modifying elements keeps the generation");
+  check(coll.get() == std::vector{43, 3, 4}, "elements modified");
+
+  // modifications that might invalidate iterators increment the generation:
+  coll.push_back(5);
+  check(coll.generation() > gen, "push_back() increments the generation");
+  gen = coll.generation();
+  coll.insert(coll.begin(), 0);
+  check(coll.generation() > gen, "insert() increments the generation");
+  gen = coll.generation();
+  coll.modify([](auto& v) { v.shrink_to_fit(); });
+  check(coll.generation() > gen, "modify() increments the generation");
+  gen = coll.generation();
+  coll = bel::versioned<std::vector<int>>{7, 8};
+  check(coll.generation() > gen, "assignment increments the generation");
+
+  static_assert(std::ranges::contiguous_range<decltype(coll)>);
+  static_assert(std::ranges::sized_range<decltype(coll)>);
+}
+
+
+void testVersionedEagerBegin()
+{
+  bel::versioned<std::vector<int>> coll{1, 2, 3, 4, 5};
+  auto vw = coll | bel::views::drop(2) | bel::views::eager_begin();
+  const auto cvw = coll | bel::views::drop(1) | bel::views::eager_begin();
+  print(vw);
+  print(cvw);
+
+  numStale = 0;
+  // no reallocation, but a different begin:
+  coll.insert(coll.begin(), 0);
+  check(*vw.begin() == 2 && std::ranges::distance(vw) == 4, "begin() recomputed after insert()");
+  check(numStale == 1, "stale begin() reported");
+  // const views can't update their cache, so they report each stale begin:
+  check(*cvw.begin() == 1 && std::ranges::distance(cvw) == 5, "begin() const recomputed after insert()");
+  check(numStale == 3, "stale begin() const reported");
+
+  // recomputed begin() is cached again:
+  numStale = 0;
+  check(*vw.begin() == 2, "begin() still valid");
+  check(numStale == 0, "recomputed begin() cached");
+
+  // reallocation:
+  for (int i = 0; i < 1000; ++i) {
+    coll.push_back(i);
+  }
+  check(*vw.begin() == 2 && std::ranges::distance(vw) == 1004, "begin() recomputed after reallocation");
+  check(*cvw.begin() == 1 && std::ranges::distance(cvw) == 1005, "begin() const recomputed after reallocation");
+
+  // with lists:
+  bel::versioned<std::list<int>> lst{1, 2, 3};
+  auto vwLst = lst | bel::views::eager_begin();
+  lst.push_front(0);
+  check(*vwLst.begin() == 0, "begin() recomputed after push_front()");
+}
+
+
+void testVectorEagerBegin()
+{
+  std::vector<int> coll{1, 2, 3, 4, 5};
+  auto vw = coll | bel::views::drop(2) | bel::views::eager_begin();
+  const auto cvw = coll | bel::views::eager_begin();
+
+  numStale = 0;
+  // reallocation without modification of the elements
+  // (keep the old buffer alive so that the stale begins are not compared with freed memory):
+  std::vector<int> oldBuffer(coll.begin(), coll.end());
+  coll.swap(oldBuffer);
+  check(*vw.begin() == 3, "begin() recomputed after reallocation of vector");
+  check(*cvw.begin() == 1, "begin() const recomputed after reallocation of vector");
+  check(numStale == 2, "stale vector begins reported");
+
+  // const eager_begin views over pipelines cache (and recompute) begin() const:
+  const auto cvwTrans = coll | bel::views::transform([] (int i) { return i * 10; })
+                             | bel::views::eager_begin();
+  const auto cvwFilter = coll | bel::views::filter([] (int i) { return i > 1; })
+                              | bel::views::eager_begin();
+  static_assert(std::ranges::range<decltype(cvwTrans)>);
+  static_assert(std::ranges::range<decltype(cvwFilter)>);
+  int sum = 0;
+  for (int i : cvwTrans) {
+    sum += i;
+  }
+  check(sum == 150, "const eager_begin over transform");
+  check(std::ranges::equal(cvwFilter, std::vector{2, 3, 4, 5}), "const eager_begin over filter");
+  numStale = 0;
+  oldBuffer.assign(coll.begin(), coll.end());
+  coll.swap(oldBuffer);
+  coll.front() = 2;
+  check(std::ranges::equal(cvwTrans, std::vector{20, 20, 30, 40, 50}), "const begin over transform recomputed");
+  check(std::ranges::equal(cvwFilter, std::vector{2, 2, 3, 4, 5}), "const begin over filter recomputed");
+  check(numStale == 2, "stale const begins reported");
+
+  // views that are not const-iterable (such as std::views::filter) have no begin() const:
+  auto vwFilter = coll | std::views::filter([] (int i) { return i > 1; }) | bel::views::eager_begin();
+  static_assert(!std::ranges::range<const decltype(vwFilter)>);
+  check(*vwFilter.begin() == 2, "begin() of non-const-iterable views");
+}
+
+
+// in-house container with contiguous elements:
+template<typename T, std::size_t N>
+class SmallVec {
+  std::array<T, N> elems_{};
+  std::size_t size_ = 0;
+ public:
+  T* begin() { return elems_.data(); }
+  T* end() { return elems_.data() + size_; }
+  const T* begin() const { return elems_.data(); }
+  const T* end() const { return elems_.data() + size_; }
+  T* data() { return elems_.data(); }
+  const T* data() const { return elems_.data(); }
+  std::size_t size() const { return size_; }
+  void push_back(const T& t) { elems_[size_++] = t; }
+};
+
+// predicate counting its copies:
+struct CountCopies {
+  int* numCopies;
+  CountCopies(int* num) : numCopies{num} {}
+  CountCopies(const CountCopies& p) : numCopies{p.numCopies} { ++*numCopies; }
+  CountCopies& operator=(const CountCopies&) = default;
+  bool operator()(int) const { return true; }
+};
+
+// in-house container without fingerprint:
+template<typename T>
+struct NoFingerprint : std::vector<T> {
+  using std::vector<T>::vector;
+};
+
+template<typename T>
+struct belleviews::stability_traits<NoFingerprint<T>> {
+  static constexpr bool stable_iterators = false;
+  static constexpr bool has_fingerprint = false;
+};
+
+
+void testStabilityTraits()
+{
+  static_assert(bel::stability_traits<std::vector<int>>::has_fingerprint);
+  static_assert(!bel::stability_traits<std::vector<int>>::stable_iterators);
+  static_assert(bel::stability_traits<std::string>::has_fingerprint);
+  static_assert(bel::stability_traits<std::deque<int>>::has_fingerprint);
+  static_assert(!bel::stability_traits<std::deque<int>>::stable_iterators);
+  static_assert(bel::stability_traits<std::list<int>>::has_fingerprint);
+  static_assert(bel::stability_traits<std::list<int>>::stable_iterators);
+  static_assert(bel::stability_traits<std::set<int>>::stable_iterators);
+  static_assert(bel::stability_traits<bel::versioned<std::list<int>>>::stable_iterators);
+  static_assert(bel::stability_traits<SmallVec<int, 10>>::has_fingerprint);
+  static_assert(bel::stability_traits<std::set<int>>::has_fingerprint);
+  static_assert(bel::stability_traits<bel::versioned<std::list<int>>>::has_fingerprint);
+  static_assert(!bel::stability_traits<NoFingerprint<int>>::has_fingerprint);
+
+  numStale = 0;
+
+  std::string s{"hello"};
+  auto vwStr = s | bel::views::drop(1) | bel::views::eager_begin();
+  s.insert(0, "well, ");
+  check(*vwStr.begin() == 'e', "string: begin() recomputed");
+
+  std::deque<int> deq{1, 2, 3};
+  auto vwDeq = deq | bel::views::eager_begin();
+  deq.push_front(0);
+  check(*vwDeq.begin() == 0, "deque: begin() recomputed");
+
+  std::list<int> lst{1, 2, 3};
+  auto vwLst = lst | bel::views::eager_begin();
+  lst.pop_front();
+  check(*vwLst.begin() == 2, "list: begin() recomputed");
+
+  std::set<int> st{1, 2, 3};
+  auto vwSet = st | bel::views::eager_begin();
+  st.insert(0);
+  check(*vwSet.begin() == 0, "set: begin() recomputed");
+
+  SmallVec<int, 10> sv;
+  sv.push_back(1);
+  auto vwSv = sv | bel::views::drop(1) | bel::views::eager_begin();
+  sv.push_back(2);
+  check(*vwSv.begin() == 2, "in-house container: begin() recomputed");
+
+  check(numStale == 5, "stale begins reported");
+
+  // caching begin() lazily checks as well:
+  std::vector<int> vec{1, 2, 3};
+  const auto vwCache = vec | bel::views::drop(1) | bel::views::cache_begin();
+  check(*vwCache.begin() == 2, "cache_begin: begin() cached");
+  vec.insert(vec.begin(), 0);
+  check(*vwCache.begin() == 1, "cache_begin: begin() recomputed");
+  check(numStale == 6, "stale cache_begin reported");
+
+  // inner views returning their base by value (fingerprint of temporary spans/subranges):
+  std::span<int> sp{vec};
+  auto vwSpan = sp | bel::views::drop(1) | bel::views::eager_begin();
+  const auto cvwSpan = sp | bel::views::drop(2) | bel::views::cache_begin();
+  check(*vwSpan.begin() == 1 && *cvwSpan.begin() == 2, "eager/cache begin of spans");
+  std::ranges::subrange sr{vec};
+  auto vwSub = sr | bel::views::drop(1) | bel::views::eager_begin();
+  check(*vwSub.begin() == 1 && numStale == 6, "eager begin of subranges");
+
+  // checking the fingerprint does not copy inner views (and their predicates):
+  int numCopies = 0;
+  auto vwPred = vec | bel::views::filter(CountCopies{&numCopies}) | bel::views::eager_begin();
+  numCopies = 0;
+  vwPred.begin();
+  std::as_const(vwPred).begin();
+  check(numCopies == 0, "no copies of inner views for fingerprints");
+}
+
+
+int main()
+{
+  // by default, stale begins are silently recomputed:
+  check(belleviews::get_stale_begin_handler() == nullptr, "no stale begin handler by default");
+  belleviews::set_stale_begin_handler(countStale);
+
+  testVersioned();
+  testVersionedEagerBegin();
+  testVectorEagerBegin();
+  testStabilityTraits();
+}
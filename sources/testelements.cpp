@@ -0,0 +1,151 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <map>
+#include <string>
+#include <thread>
+#include <ranges>
+#include "belleviews.hpp"
+#include "belletransform.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+// in-house tuple-like type with a member get<>():
+struct Point {
+  int x = 0;
+  int y = 0;
+  template<std::size_t N>
+  int& get() & { if constexpr (N == 0) return x; else return y; }
+  template<std::size_t N>
+  const int& get() const& { if constexpr (N == 0) return x; else return y; }
+};
+
+// in-house tuple-like type with get<>() found by ADL:
+namespace geo {
+  struct Entry {
+    std::string name;
+    double value = 0;
+  };
+  template<std::size_t N>
+  auto& get(Entry& e) { if constexpr (N == 0) return e.name; else return e.value; }
+  template<std::size_t N>
+  const auto& get(const Entry& e) { if constexpr (N == 0) return e.name; else return e.value; }
+}
+
+template<>
+struct std::tuple_size<Point> : std::integral_constant<std::size_t, 2> {};
+template<std::size_t N>
+struct std::tuple_element<N, Point> { using type = int; };
+template<>
+struct std::tuple_size<geo::Entry> : std::integral_constant<std::size_t, 2> {};
+template<>
+struct std::tuple_element<0, geo::Entry> { using type = std::string; };
+template<>
+struct std::tuple_element<1, geo::Entry> { using type = double; };
+
+
+void testStd()
+{
+  std::map<std::string, int> coll{{"one", 1}, {"two", 2}, {"three", 3}};
+
+  auto keys = coll | bel::views::keys();
+  auto vals = coll | bel::views::values();
+  print(keys);
+  print(vals);
+  check(*keys.begin() == "one", "keys");
+
+  // references to the members:
+  for (int& v : vals) {
+    v *= 10;
+  }
+  check(coll["two"] == 20, "values modified via values view");
+  check(&*vals.begin() == &coll.begin()->second, "values are references");
+  static_assert(!SupportsAssign<decltype(*keys.begin()), std::string>);
+  static_assert(SupportsAssign<decltype(*vals.begin()), int>);
+
+  // const views yield const references:
+  const auto cvals = coll | bel::views::values();
+  static_assert(!SupportsAssign<decltype(*cvals.begin()), int>);
+  static_assert(std::same_as<decltype(*cvals.begin()), const int&>);
+  static_assert(std::ranges::bidirectional_range<decltype(cvals)>);
+  static_assert(std::ranges::common_range<decltype(cvals)>);
+
+  // random access is kept:
+  std::vector<std::pair<int, std::string>> vec{{1, "a"}, {2, "b"}, {3, "c"}};
+  auto vw = bel::views::elements<1>(vec);
+  static_assert(std::ranges::random_access_range<decltype(vw)>);
+  static_assert(std::ranges::sized_range<decltype(vw)>);
+  static_assert(std::same_as<std::iterator_traits<std::ranges::iterator_t<decltype(vw)>>::iterator_category,
+                             std::random_access_iterator_tag>);
+  check(vw.size() == 3 && vw[2] == "c" && vw.end() - vw.begin() == 3, "elements<1>");
+  static_assert(std::ranges::borrowed_range<decltype(vw)>);
+
+  // underlying ranges yielding values yield values:
+  auto vwTmp = vec | bel::views::transform([] (const auto& p) { return std::pair{p.first * 2, p.second}; })
+                   | bel::views::keys();
+  static_assert(std::same_as<decltype(*vwTmp.begin()), int>);
+  check(vwTmp[1] == 4, "keys of values");
+
+  // non-common ranges:
+  std::list<std::tuple<int, char, double>> lst{{1, 'a', 1.5}, {2, 'b', 2.5}};
+  auto vwLst = lst | bel::views::take(1) | bel::views::elements<2>();
+  check(std::ranges::distance(vwLst) == 1 && *vwLst.begin() == 1.5, "elements<2>");
+
+  // pipelines:
+  auto vwPipe = coll | bel::views::drop(1) | bel::views::keys() | bel::views::take(1);
+  check(*vwPipe.begin() == "three", "pipeline");
+}
+
+
+void testTupleLike()
+{
+  // member get<>():
+  std::vector<Point> pts{{1, 2}, {3, 4}, {5, 6}};
+  auto ys = pts | bel::views::elements<1>();
+  print(ys);
+  for (int& y : ys) {
+    ++y;
+  }
+  check(pts[1].y == 5, "member get<>() yields references");
+  check(&ys[2] == &pts[2].y, "no copies of the members");
+  const auto cxs = pts | bel::views::keys();
+  static_assert(std::same_as<decltype(*cxs.begin()), const int&>);
+  static_assert(std::ranges::random_access_range<decltype(cxs)>);
+
+  // ADL get<>():
+  std::list<geo::Entry> entries{{"pi", 3.14}, {"e", 2.72}};
+  const auto names = entries | bel::views::keys();
+  auto values = entries | bel::views::values();
+  print(names);
+  check(*names.begin() == "pi", "ADL get<>()");
+  *values.begin() = 3.1416;
+  check(entries.front().value == 3.1416, "ADL get<>() yields references");
+  static_assert(std::same_as<decltype(*names.begin()), const std::string&>);
+
+  // concurrent iterations:
+  double sum1 = 0, sum2 = 0;
+  {
+    std::jthread t1{[&] { for (double d : std::as_const(values)) sum1 += d; }};
+    for (double d : std::as_const(values)) sum2 += d;
+  }
+  check(sum1 == sum2, "concurrent iterations");
+}
+
+
+int main()
+{
+  testStd();
+  testTupleLike();
+}
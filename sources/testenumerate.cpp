@@ -0,0 +1,108 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <string>
+#include <sstream>
+#include <thread>
+#include <ranges>
+#include "belleviews.hpp"
+#include "testutils.hpp"
+
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+void testRandomAccess()
+{
+  std::vector<std::string> coll{"zero", "one", "two", "three"};
+
+  auto vw = coll | bel::views::enumerate();
+  for (const auto& [idx, elem] : vw) {
+    std::cout << idx << ": " << elem << '\n';
+  }
+  static_assert(std::ranges::random_access_range<decltype(vw)>);
+  static_assert(std::ranges::sized_range<decltype(vw)>);
+  static_assert(std::ranges::common_range<decltype(vw)>);
+  static_assert(std::ranges::borrowed_range<decltype(vw)>);
+  check(vw.size() == 4, "size()");
+
+  // the index is derived from the position:
+  auto pos = vw.begin() + 2;
+  check(pos.index() == 2 && std::get<1>(*pos) == "two", "random access");
+  check(std::get<0>(vw[3]) == 3 && std::get<1>(vw[3]) == "three", "operator[]");
+  --pos;
+  check(std::get<0>(*pos) == 1, "operator--");
+  check(std::get<0>(*(vw.end() - 1)) == 3, "end()");
+
+  // modify the elements:
+  for (auto [idx, elem] : vw) {
+    elem += std::to_string(idx);
+  }
+  check(coll[0] == "zero0" && coll[3] == "three3", "modify elements");
+
+  // propagates const:
+  const auto cvw = coll | bel::views::enumerate();
+  static_assert(!SupportsAssign<decltype(std::get<1>(*cvw.begin())), std::string>);
+  static_assert(SupportsAssign<decltype(std::get<1>(*vw.begin())), std::string>);
+
+  // the value type is a tuple of values:
+  static_assert(std::same_as<std::ranges::range_value_t<decltype(vw)>,
+                             std::tuple<std::ptrdiff_t, std::string>>);
+
+  // in pipelines:
+  auto vwDrop = coll | bel::views::drop(2) | bel::views::enumerate();
+  check(std::get<0>(*vwDrop.begin()) == 0 && std::get<1>(*vwDrop.begin()) == "two2", "enumerate after drop");
+}
+
+
+void testOtherRanges()
+{
+  std::list<int> lst{10, 20, 30};
+  auto vw = lst | bel::views::enumerate();
+  static_assert(std::ranges::bidirectional_range<decltype(vw)>);
+  static_assert(std::ranges::common_range<decltype(vw)>);
+  long sum = 0;
+  for (auto [idx, elem] : vw) {
+    sum += idx * elem;
+  }
+  check(sum == 0 * 10 + 1 * 20 + 2 * 30, "list");
+  auto last = std::ranges::prev(vw.end());
+  check(last.index() == 2 && std::get<1>(*last) == 30, "end() of list");
+
+  // filtered elements:
+  auto vwFilter = lst | bel::views::filter([](int i) { return i > 10; }) | bel::views::enumerate();
+  check(std::get<0>(*std::ranges::next(vwFilter.begin())) == 1, "enumerate after filter");
+
+  // input ranges:
+  std::istringstream strm{"a b c"};
+  auto vwIn = std::views::istream<char>(strm) | bel::views::enumerate();
+  std::string str;
+  for (auto [idx, c] : vwIn) {
+    str += std::to_string(idx) + c;
+  }
+  check(str == "0a1b2c", "input range");
+}
+
+
+void testConcurrency()
+{
+  std::vector<int> coll(10'000, 1);
+  const auto vw = coll | bel::views::enumerate();
+  long sum1 = 0, sum2 = 0;
+  {
+    std::jthread t{[&] {
+                     for (auto [idx, elem] : vw) sum1 += idx * elem;
+                   }};
+    for (auto [idx, elem] : vw) sum2 += idx;
+  }
+  check(sum1 == 9'999L * 10'000 / 2 && sum2 == sum1, "concurrent iterations");
+}
+
+
+int main()
+{
+  testRandomAccess();
+  testOtherRanges();
+  testConcurrency();
+}
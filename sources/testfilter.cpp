@@ -3,11 +3,13 @@
 #include <array>
 #include <vector>
 #include <list>
+#include <forward_list>
 #include <numeric>
 #include <thread>
 #include <complex>
 #include <execution>
 #include "belleviews.hpp"
+#include "testutils.hpp"
 
 auto times3 = [] (auto x) { return x % 3 == 0; };
 auto notTimes3 = [] (auto x) { return x % 3 != 0; };
@@ -141,6 +143,29 @@ void testBasics()
     static_assert(std::ranges::bidirectional_range<decltype(v)>);
     static_assert(!std::ranges::random_access_range<decltype(v)>);
   }
+
+  // predicates without captures need no extra space:
+  {
+    std::vector vec{1, 2, 3, 4, 5, 6, 7, 8};
+    auto vAll = bel::views::all(vec);
+    auto vFilt = vec | bel::views::filter(notTimes3);
+    static_assert(sizeof(vFilt) == sizeof(vAll));
+    // predicates with captures are still copy assignable:
+    int max = 5;
+    auto vFiltCap1 = vec | bel::views::filter([max](int i) { return i < max; });
+    auto vFiltCap2 = vFiltCap1;
+    vFiltCap2 = vFiltCap1;
+    printConst(vFiltCap2);
+  }
+
+  // filters over non-simple views (such as filters) can iterate when const:
+  {
+    std::forward_list coll{1, 2, 3, 4, 5, 6, 7, 8};
+    auto vFilt = coll | bel::views::filter(notTimes3) | bel::views::drop(1)
+                      | bel::views::filter([](int i) { return i % 2 == 0; });
+    printUniversal(vFilt);   // 2 4 8
+    printConst(vFilt);       // 2 4 8
+  }
 }
 
 
@@ -203,7 +228,7 @@ void testConcurrentIteration()
   static_assert(!std::ranges::random_access_range<decltype(coll)>);
 
   // test concurrent read iterations:
-  auto v3Std = coll | std::views::filter(notTimes3);
+  [[maybe_unused]] auto v3Std = coll | std::views::filter(notTimes3);
   //auto sumUB = concurrentPrintAndAccum(v3std);             // RUNTIME ERROR with std views
 
   auto v3 = coll | bel::views::filter(notTimes3);
@@ -304,6 +329,21 @@ void testFilterMod()
   }
 }
 
+void testNonConstIterableBase()
+{
+  // underlying views that are not const-iterable (only the non-const view is usable):
+  std::vector<int> coll{1, 2, 3, 4, 5, 6, 7, 8, 9};
+  auto stdFilter = coll | std::views::filter(notTimes3);
+  auto vw = stdFilter | bel::views::filter([] (int i) { return i % 2 == 0; });
+  static_assert(!std::ranges::range<const decltype(vw)>);
+  std::vector<int> result;
+  for (int i : vw) {
+    result.push_back(i);
+  }
+  check(result == std::vector{2, 4, 8}, "filter over non-const-iterable views");
+}
+
+
 int main()
 {
   testBasics();
@@ -312,5 +352,6 @@ int main()
   testConcurrentIteration();
   testReadme();
   testFilterMod();
+  testNonConstIterableBase();
 }
 
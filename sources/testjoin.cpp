@@ -0,0 +1,121 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <span>
+#include <string>
+#include <thread>
+#include <ranges>
+#include "belleviews.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+void testJoin()
+{
+  std::vector<std::vector<int>> coll{{1, 2}, {}, {3}, {}, {}, {4, 5, 6}, {}};
+
+  auto vw = coll | bel::views::join();
+  print(vw);
+  check(std::ranges::distance(vw) == 6, "number of elements (empty inner ranges skipped)");
+  check(std::ranges::equal(vw, std::vector{1, 2, 3, 4, 5, 6}), "elements");
+  static_assert(std::ranges::bidirectional_range<decltype(vw)>);
+  static_assert(std::ranges::common_range<decltype(vw)>);
+
+  // iterating backward:
+  check(std::ranges::equal(vw | std::views::reverse, std::vector{6, 5, 4, 3, 2, 1}), "backward");
+
+  // modify the elements:
+  for (int& i : vw) {
+    i *= 10;
+  }
+  check(coll[0][1] == 20 && coll[5][2] == 60, "modify elements");
+
+  // propagates const (also for inner ranges with shallow const such as spans):
+  const auto cvw = coll | bel::views::join();
+  static_assert(!SupportsAssign<decltype(*cvw.begin()), int>);
+  std::vector<int> v1{1, 2}, v2{3};
+  std::vector<std::span<int>> spans{v1, v2};
+  const auto cvwSpans = spans | bel::views::join();
+  static_assert(!SupportsAssign<decltype(*cvwSpans.begin()), int>);
+  check(std::ranges::distance(cvwSpans) == 3, "join spans");
+
+  // other inner ranges:
+  std::vector<std::list<std::string>> lists{{"a", "b"}, {}, {"c"}};
+  auto vwLists = lists | bel::views::join();
+  check(std::ranges::distance(vwLists) == 3 && *std::ranges::next(vwLists.begin(), 2) == "c", "join lists");
+
+  // all inner ranges empty:
+  std::vector<std::vector<int>> empties(5);
+  check(std::ranges::empty(empties | bel::views::join()), "all inner ranges empty");
+}
+
+
+void testSegments()
+{
+  std::vector<std::vector<int>> coll{{1, 2}, {}, {3, 2}, {2}};
+  auto vw = coll | bel::views::join();
+  const auto cvw = coll | bel::views::join();
+
+  // the segmented structure:
+  int numSegments = 0;
+  cvw.for_each_segment([&](auto seg) {
+                         static_assert(std::ranges::contiguous_range<decltype(seg)>);
+                         static_assert(!SupportsAssign<decltype(*seg.begin()), int>);
+                         ++numSegments;
+                       });
+  check(numSegments == 4, "for_each_segment()");
+
+  // algorithms using the segments:
+  long sum = 0;
+  bel::for_each(cvw, [&](int i) { sum += i; });
+  check(sum == 10, "bel::for_each()");
+  bel::for_each(vw, [](int& i) { ++i; });
+  check(coll[3][0] == 3, "bel::for_each() modifying");
+  check(bel::count(vw, 3) == 3 && bel::count(cvw, 1) == 0, "bel::count()");
+
+  // other ranges:
+  std::vector<int> vec{1, 2, 2};
+  check(bel::count(vec, 2) == 2, "bel::count() of non-segmented range");
+
+  // nested segments:
+  std::vector<std::vector<std::vector<int>>> nested{{{1}, {2, 3}}, {}, {{4}}};
+  auto vwNested = nested | bel::views::join() | bel::views::join();
+  check(std::ranges::equal(vwNested, std::vector{1, 2, 3, 4}), "join of join");
+  sum = 0;
+  bel::for_each(vwNested, [&](int i) { sum += i; });
+  check(sum == 10, "bel::for_each() of nested segments");
+}
+
+
+void testConcurrency()
+{
+  std::vector<std::vector<int>> coll(1'000, std::vector<int>(10, 1));
+  const auto vw = coll | bel::views::join();
+  long sum1 = 0, sum2 = 0;
+  {
+    std::jthread t{[&] {
+                     for (int i : vw) sum1 += i;
+                   }};
+    bel::for_each(vw, [&](int i) { sum2 += i; });
+  }
+  check(sum1 == 10'000 && sum2 == 10'000, "concurrent iterations");
+}
+
+
+int main()
+{
+  testJoin();
+  testSegments();
+  testConcurrency();
+}
@@ -0,0 +1,77 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <numeric>
+#include <execution>
+#include <ranges>
+#include "belleviews.hpp"
+#include "belletransform.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+int main()
+{
+  std::list<int> coll{1, 2, 3, 4, 5, 6, 7, 8};
+
+  // function calls show how often the pipeline is evaluated:
+  std::atomic<int> numCalls = 0;
+  auto square = [&numCalls] (int i) { ++numCalls; return i * i; };
+  auto isEven = [] (int i) { return i % 2 == 0; };
+
+  auto mat = coll | bel::views::transform(square)
+                  | bel::views::filter(isEven)
+                  | bel::views::materialize();
+  // (filter calls square() for each element and again for each dereferenced element):
+  int numEval = numCalls;
+  check(numEval == 8 + 4, "pipeline evaluated on construction");
+  print(mat);
+  print(mat);
+  print(mat | bel::views::drop(1));
+  check(numCalls == numEval, "pipeline evaluated only once");
+  check(mat.size() == 4 && mat[1] == 16 && mat.front() == 4 && mat.back() == 64, "elements");
+
+  // always const, random-access, sized, and contiguous:
+  static_assert(std::ranges::contiguous_range<decltype(mat)>);
+  static_assert(std::ranges::sized_range<decltype(mat)>);
+  static_assert(!SupportsAssign<decltype(*mat.begin()), int>);
+  static_assert(!SupportsAssign<decltype(mat[0]), int>);
+  // not a view, so pipelines refer to it instead of copying the elements:
+  static_assert(!std::ranges::view<decltype(mat)>);
+  static_assert(std::same_as<decltype(std::views::all(mat)), std::ranges::ref_view<decltype(mat)>>);
+
+  // concurrent iterations (also by parallel algorithms):
+  const auto& cmat = mat;
+  int sum = 0;
+  {
+    std::jthread t1{[&] { print(cmat); }};
+    sum = std::reduce(std::execution::par, cmat.begin(), cmat.end(), 0);
+  }
+  check(sum == 4 + 16 + 36 + 64, "concurrent iterations");
+
+  // refresh() evaluates again, reusing the capacity:
+  coll.pop_back();
+  auto data = mat.data();
+  mat.refresh();
+  check(numCalls == numEval + 7 + 3, "refresh() evaluates the pipeline again");
+  check(mat.size() == 3 && mat.data() == data, "refresh() reuses the buffer");
+  print(mat);
+
+  // from temporaries:
+  auto mat2 = bel::views::materialize(std::vector{3, 2, 1} | bel::views::take(2));
+  check(mat2.size() == 2 && mat2[0] == 3, "materialize(temporary)");
+}
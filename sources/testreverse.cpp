@@ -0,0 +1,117 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <string>
+#include <thread>
+#include <ranges>
+#include "belleviews.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+void testReverse()
+{
+  std::list<int> coll{1, 2, 3, 4, 5};
+
+  auto vw = coll | bel::views::reverse();
+  print(vw);
+  check(std::ranges::equal(vw, std::vector{5, 4, 3, 2, 1}), "reverse list");
+  check(vw.size() == 5, "size()");
+  for (int& i : vw) {
+    i *= 10;
+  }
+  check(coll.front() == 10, "modify elements");
+
+  // propagates const:
+  const auto cvw = coll | bel::views::reverse();
+  static_assert(!SupportsAssign<decltype(*cvw.begin()), int>);
+  static_assert(SupportsAssign<decltype(*vw.begin()), int>);
+
+  // not common (the end is not cached but computed with each begin()):
+  auto vwFilter = coll | bel::views::filter([](int i) { return i > 20; }) | bel::views::reverse();
+  check(std::ranges::equal(vwFilter, std::vector{50, 40, 30}), "reverse filter");
+  coll.push_back(60);
+  check(*vwFilter.begin() == 60, "no cached end()");
+  const auto cvwFilter = coll | bel::views::filter([](int i) { return i > 20; }) | bel::views::reverse();
+  check(*cvwFilter.begin() == 60, "reverse filter when const");
+
+  // reverse(reverse(v)) is v:
+  auto vw2 = coll | bel::views::reverse() | bel::views::reverse();
+  static_assert(std::same_as<decltype(vw2), std::views::all_t<std::list<int>&>>);
+  check(std::ranges::equal(vw2, coll), "reverse of reverse");
+
+  // reversing const reverse views keeps const:
+  auto cvw2 = cvw | bel::views::reverse();
+  static_assert(!SupportsAssign<decltype(*cvw2.begin()), int>);
+  check(std::ranges::equal(cvw2, coll), "reverse of const reverse");
+}
+
+
+void testRandomAccess()
+{
+  std::vector<int> coll{1, 2, 3, 4, 5, 6};
+
+  // drop, take, and sub of random-access ranges yield sub_views of reverse iterators:
+  auto vwDrop = coll | bel::views::drop(2) | bel::views::reverse();
+  static_assert(std::same_as<decltype(vwDrop),
+                             bel::subrange<std::reverse_iterator<std::vector<int>::iterator>>>);
+  check(std::ranges::equal(vwDrop, std::vector{6, 5, 4, 3}), "reverse drop");
+
+  auto vwTake = coll | bel::views::drop(1) | bel::views::take(3) | bel::views::reverse();
+  static_assert(std::same_as<decltype(vwTake),
+                             bel::subrange<std::reverse_iterator<std::vector<int>::iterator>>>);
+  check(std::ranges::equal(vwTake, std::vector{4, 3, 2}), "reverse take");
+
+  auto vwSub = bel::views::sub(coll.begin() + 1, coll.end() - 1) | bel::views::reverse();
+  check(std::ranges::equal(vwSub, std::vector{5, 4, 3, 2}), "reverse sub");
+
+  // and reversing them again yields sub_views of the underlying iterators:
+  auto vwSub2 = vwSub | bel::views::reverse();
+  static_assert(std::same_as<decltype(vwSub2), bel::subrange<std::vector<int>::iterator>>);
+  check(std::ranges::equal(vwSub2, std::vector{2, 3, 4, 5}), "reverse reverse sub");
+
+  // const propagates:
+  const auto cvwDrop = coll | bel::views::drop(2) | bel::views::reverse();
+  static_assert(!SupportsAssign<decltype(*cvwDrop.begin()), int>);
+  const auto cvw = coll | bel::views::reverse();
+  static_assert(!SupportsAssign<decltype(*cvw.begin()), int>);
+  static_assert(std::ranges::random_access_range<decltype(cvw)>);
+  check(cvw[0] == 6 && cvw.size() == 6, "random access");
+
+  // reversing const reversed sub_views (which yield const reverse iterators):
+  const auto cvwDrop1 = coll | bel::views::drop(1) | bel::views::reverse();
+  auto cvwDrop2 = bel::views::reverse(cvwDrop1);
+  static_assert(!SupportsAssign<decltype(*cvwDrop2.begin()), int>);
+  check(std::ranges::equal(cvwDrop2, std::vector{2, 3, 4, 5, 6}), "reverse of const reversed sub_view");
+  const auto cvw2 = cvw | bel::views::reverse();
+  static_assert(!SupportsAssign<decltype(*cvw2.begin()), int>);
+  check(std::ranges::equal(cvw2, coll), "reverse of const reverse of vector");
+
+  // concurrent iterations:
+  long sum1 = 0, sum2 = 0;
+  {
+    std::jthread t{[&] {
+                     for (int i : cvw) sum1 += i;
+                   }};
+    for (int i : cvw) sum2 += i;
+  }
+  check(sum1 == 21 && sum2 == 21, "concurrent iterations");
+}
+
+
+int main()
+{
+  testReverse();
+  testRandomAccess();
+}
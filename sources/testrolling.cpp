@@ -0,0 +1,102 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <string>
+#include <thread>
+#include <ranges>
+#include "belleviews.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+template<typename Rg>
+std::vector<std::ranges::range_value_t<Rg>> toVector(Rg&& rg)
+{
+  std::vector<std::ranges::range_value_t<Rg>> v;
+  for (auto&& elem : rg) {
+    v.push_back(elem);
+  }
+  return v;
+}
+
+
+void testSum()
+{
+  std::vector<int> coll{1, 2, 3, 4, 5, 6};
+
+  auto vw = coll | bel::views::rolling_sum(3);
+  print(vw);
+  check(toVector(vw) == std::vector{6, 9, 12, 15}, "rolling_sum()");
+  check(vw.size() == 4 && std::ranges::distance(vw) == 4, "number of windows");
+  static_assert(std::same_as<decltype(*vw.begin()), int>);
+  static_assert(std::ranges::forward_range<decltype(vw)>);
+
+  // fewer elements than the window size:
+  auto vwBig = coll | bel::views::rolling_sum(7);
+  check(vwBig.empty() && vwBig.size() == 0, "no window");
+  check(toVector(coll | bel::views::rolling_sum(1)) == coll, "window of one element");
+
+  // non-random-access ranges:
+  std::list<double> lst{0.5, 1.5, 2.5};
+  check(toVector(lst | bel::views::rolling_sum(2)) == std::vector{2.0, 4.0}, "rolling_sum() of list");
+}
+
+
+void testMinMax()
+{
+  std::vector<int> coll{4, 2, 12, 3, 8, 3, 7, 1};
+
+  auto vwMin = coll | bel::views::rolling_min(3);
+  auto vwMax = coll | bel::views::rolling_max(3);
+  print(vwMin);
+  print(vwMax);
+  check(toVector(vwMin) == std::vector{2, 2, 3, 3, 3, 1}, "rolling_min()");
+  check(toVector(vwMax) == std::vector{12, 12, 12, 8, 8, 7}, "rolling_max()");
+
+  // min/max yield references to the elements:
+  check(&*vwMax.begin() == &coll[2], "rolling_max() yields references");
+  static_assert(SupportsAssign<decltype(*vwMin.begin()), int>);
+
+  // const views yield const references:
+  const auto cvw = coll | bel::views::rolling_min(2);
+  static_assert(!SupportsAssign<decltype(*cvw.begin()), int>);
+  check(toVector(cvw) == std::vector{2, 2, 3, 3, 3, 3, 1}, "rolling_min() const");
+
+  // iterators keep their state:
+  auto pos = vwMax.begin();
+  ++pos;
+  auto pos2 = pos;
+  ++pos;
+  ++pos;
+  check(*pos2 == 12 && *pos == 8, "copied iterators");
+
+  // non-random-access ranges and pipelines:
+  std::list<std::string> lst{"b", "d", "a", "c"};
+  auto vwStr = lst | bel::views::rolling_max(2) | bel::views::take(2);
+  check(toVector(vwStr) == std::vector<std::string>{"d", "d"}, "rolling_max() of list");
+
+  // concurrent iterations:
+  int sum1 = 0, sum2 = 0;
+  {
+    std::jthread t1{[&] { for (int i : cvw) sum1 += i; }};
+    for (int i : cvw) sum2 += i;
+  }
+  check(sum1 == 17 && sum2 == 17, "concurrent iterations");
+}
+
+
+int main()
+{
+  testSum();
+  testMinMax();
+}
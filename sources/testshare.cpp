@@ -0,0 +1,79 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <string>
+#include <thread>
+#include <numeric>
+#include <execution>
+#include <ranges>
+#include "belleviews.hpp"
+#include "belletransform.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+template<typename Rg>
+concept CanShare = requires (Rg&& rg) { bel::views::share(std::forward<Rg>(rg)); };
+
+
+int main()
+{
+  std::vector<int> vec(100'000);
+  std::iota(vec.begin(), vec.end(), 0);
+  const int* data = vec.data();
+
+  // move the data into a shared buffer:
+  auto sv = bel::views::share(std::move(vec));
+  check(sv.data() == data, "share() moves the data");
+  check(sv.size() == 100'000, "size()");
+
+  // copies share the data:
+  auto sv2 = sv;
+  check(sv2.data() == data && sv.use_count() == 2, "copies share the data");
+
+  // always const:
+  static_assert(!SupportsAssign<decltype(*sv.begin()), int>);
+  static_assert(!SupportsAssign<decltype(sv[0]), int>);
+  static_assert(std::ranges::contiguous_range<decltype(sv)>);
+  static_assert(std::ranges::view<decltype(sv)>);
+  static_assert(std::copyable<decltype(sv)>);
+
+  // only for rvalues:
+  std::list<std::string> lst{"one", "two", "three"};
+  static_assert(!CanShare<std::list<std::string>&>);
+  static_assert(CanShare<std::list<std::string>>);
+  auto svLst = std::move(lst) | bel::views::share();
+  print(svLst);
+
+  // composes with all belle adaptors:
+  print(svLst | bel::views::drop(1));
+  print(svLst | bel::views::take(2) | bel::views::transform([] (const auto& s) { return s.size(); }));
+  print(svLst | bel::views::filter([] (const auto& s) { return s.size() == 3; }));
+
+  // fan out to worker threads (no copy of the data):
+  std::vector<long> sums(4);
+  {
+    std::vector<std::jthread> workers;
+    for (std::size_t w = 0; w < sums.size(); ++w) {
+      workers.emplace_back([part = sv | bel::views::drop(static_cast<std::ptrdiff_t>(w) * 25'000) | bel::views::take(25'000),
+                            &sums, w] {
+                             sums[w] = std::reduce(std::execution::par, part.begin(), part.end(), 0L);
+                           });
+    }
+  }
+  check(std::reduce(sums.begin(), sums.end()) == 100'000L * 99'999 / 2, "fan out to workers");
+
+  // moving copies (the source stays valid):
+  auto sv3 = std::move(sv2);
+  check(sv2.data() == data && sv3.data() == data, "moved-from view is still valid");
+}
@@ -0,0 +1,111 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <forward_list>
+#include <string>
+#include <thread>
+#include <numeric>
+#include <ranges>
+#include "belleviews.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& window : coll) {
+    std::cout << "[ ";
+    for (const auto& elem : window) {
+      std::cout << elem << ' ';
+    }
+    std::cout << "] ";
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+void testRandomAccess()
+{
+  std::vector<int> coll{1, 2, 3, 4, 5};
+
+  auto vw = coll | bel::views::slide(3);
+  print(vw);
+  check(vw.size() == 3, "number of windows");
+  check(std::ranges::distance(vw) == 3, "number of windows iterated");
+  check(vw[1].size() == 3 && vw[1][0] == 2 && vw[2][2] == 5, "windows");
+
+  // windows are sub_views of the underlying iterators:
+  static_assert(std::same_as<std::ranges::range_value_t<decltype(vw)>,
+                             belleviews::sub_view<std::vector<int>::iterator, std::vector<int>::iterator>>);
+  static_assert(std::ranges::random_access_range<decltype(vw)>);
+  static_assert(std::ranges::common_range<decltype(vw)>);
+  check(&vw[2][0] == &coll[2], "windows refer to the elements");
+  for (auto window : vw) {
+    window[0] *= 10;
+  }
+  check(coll == std::vector{10, 20, 30, 4, 5}, "modify elements via windows");
+
+  // iterate backward:
+  auto pos = vw.end();
+  --pos;
+  check((*pos)[0] == 30 && (*pos).size() == 3, "last window");
+
+  // const views yield windows of const elements:
+  const auto cvw = coll | bel::views::slide(2);
+  static_assert(!SupportsAssign<decltype((*cvw.begin())[0]), int>);
+  check(cvw.size() == 4 && cvw.end() - cvw.begin() == 4, "const view");
+
+  // fewer elements than the window size:
+  auto vwBig = coll | bel::views::slide(6);
+  check(vwBig.empty() && vwBig.size() == 0 && vwBig.begin() == vwBig.end(), "no window");
+  auto vwAll = coll | bel::views::slide(5);
+  check(vwAll.size() == 1 && std::ranges::distance(vwAll) == 1, "one window");
+
+  // borrowed if the underlying range is borrowed:
+  static_assert(std::ranges::borrowed_range<decltype(vw)>);
+}
+
+
+void testForward()
+{
+  std::list<int> coll{1, 2, 3, 4, 5, 6};
+
+  // moving averages:
+  std::vector<double> avg;
+  for (const auto& window : coll | bel::views::slide(4)) {
+    avg.push_back(std::accumulate(window.begin(), window.end(), 0.0) / 4);
+  }
+  check(avg == std::vector{2.5, 3.5, 4.5}, "moving averages");
+
+  const auto cvw = coll | bel::views::slide(2);
+  static_assert(std::ranges::bidirectional_range<decltype(cvw)>);
+  static_assert(!SupportsAssign<decltype(*(*cvw.begin()).begin()), int>);
+  check(cvw.size() == 5, "size() of sized non-random-access ranges");
+
+  std::forward_list<int> fl{1, 2, 3};
+  auto vwFl = fl | bel::views::slide(2);
+  check(std::ranges::distance(vwFl) == 2 && *(*++vwFl.begin()).begin() == 2, "forward ranges");
+  auto vwEmpty = fl | bel::views::slide(4);
+  check(vwEmpty.begin() == vwEmpty.end(), "no window of forward ranges");
+
+  // pipelines:
+  auto vwPipe = coll | bel::views::drop(2) | bel::views::slide(3) | bel::views::take(1);
+  check(*(*vwPipe.begin()).begin() == 3, "pipeline");
+
+  // concurrent iterations:
+  int num1 = 0, num2 = 0;
+  {
+    std::jthread t1{[&] { for (const auto& w : cvw) num1 += w.front(); }};
+    for (const auto& w : cvw) num2 += w.front();
+  }
+  check(num1 == 15 && num2 == 15, "concurrent iterations");
+}
+
+
+int main()
+{
+  testRandomAccess();
+  testForward();
+}
@@ -0,0 +1,111 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <ranges>
+#include "belleviews.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << '"' << elem << "\" ";
+  }
+  std::cout << '\n';
+}
+
+template<typename Rg>
+std::vector<std::string> toStrings(Rg&& rg)
+{
+  std::vector<std::string> v;
+  for (auto sv : rg) {
+    v.emplace_back(sv);
+  }
+  return v;
+}
+
+using Strings = std::vector<std::string>;
+
+
+void testChar()
+{
+  std::string row{"id,name,,value"};
+
+  auto vw = row | bel::views::split(',');
+  print(vw);
+  check(toStrings(vw) == Strings{"id", "name", "", "value"}, "split(char)");
+
+  // yields string_views to the characters:
+  static_assert(std::same_as<std::ranges::range_value_t<decltype(vw)>, std::string_view>);
+  check((*vw.begin()).data() == row.data(), "string_views refer to the characters");
+  static_assert(std::ranges::forward_range<decltype(vw)>);
+  static_assert(std::ranges::common_range<decltype(vw)>);
+
+  // const views (with the same iterators):
+  const auto cvw = bel::views::split(row, ',');
+  check(std::ranges::distance(cvw) == 4, "const view");
+  static_assert(std::same_as<decltype(cvw.begin()), decltype(vw.begin())>);
+
+  // as std::views::split, leading and trailing delimiters yield empty strings:
+  check(toStrings(std::string_view{",a,"} | bel::views::split(',')) == Strings{"", "a", ""},
+        "leading and trailing delimiters");
+  check(toStrings(std::string_view{","} | bel::views::split(',')) == Strings{"", ""}, "only delimiter");
+  check(toStrings(std::string_view{"abc"} | bel::views::split(',')) == Strings{"abc"}, "no delimiter");
+  auto vwEmpty = std::string_view{} | bel::views::split(',');
+  check(vwEmpty.begin() == vwEmpty.end(), "empty text");
+
+  // borrowed for borrowed ranges:
+  static_assert(std::ranges::borrowed_range<decltype(std::string_view{} | bel::views::split(','))>);
+
+  // vectors of chars:
+  std::vector<char> buf{'a', '\n', 'b', '\n'};
+  check(toStrings(buf | bel::views::split('\n')) == Strings{"a", "b", ""}, "split(vector<char>)");
+
+  // other character types:
+  std::wstring ws{L"x;y"};
+  auto vwWs = ws | bel::views::split(L';');
+  static_assert(std::same_as<std::ranges::range_value_t<decltype(vwWs)>, std::wstring_view>);
+  check(*vwWs.begin() == L"x", "split(wstring)");
+}
+
+
+void testString()
+{
+  std::string text{"line 1\r\nline 2\r\n\r\nline 4"};
+
+  auto vw = text | bel::views::split("\r\n");
+  print(vw);
+  check(toStrings(vw) == Strings{"line 1", "line 2", "", "line 4"}, "split(string literal)");
+
+  std::string delim{", "};
+  check(toStrings(bel::views::split(std::string_view{"a, b,c"}, delim)) == Strings{"a", "b,c"}, "split(string)");
+  // temporary strings would dangle:
+  static_assert(!std::invocable<decltype(bel::views::split), std::string>);
+  static_assert(std::invocable<decltype(bel::views::split), std::string&>);
+
+  // pipelines:
+  auto vwPipe = text | bel::views::split("\r\n") | bel::views::drop(1) | bel::views::take(1);
+  check(*vwPipe.begin() == "line 2", "pipeline");
+
+  // concurrent iterations:
+  std::string log(10'000, 'x');
+  for (std::size_t i = 0; i < log.size(); i += 100) {
+    log[i] = '\n';
+  }
+  const auto lines = log | bel::views::split('\n');
+  std::size_t len1 = 0, len2 = 0;
+  {
+    std::jthread t1{[&] { for (auto ln : lines) len1 += ln.size(); }};
+    for (auto ln : lines) len2 += ln.size();
+  }
+  check(len1 == 9'900 && len2 == 9'900, "concurrent iterations");
+}
+
+
+int main()
+{
+  testChar();
+  testString();
+}
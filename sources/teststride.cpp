@@ -0,0 +1,129 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <string>
+#include <thread>
+#include <numeric>
+#include <ranges>
+#include "belleviews.hpp"
+#include "testutils.hpp"
+
+
+void print(const auto& coll)
+{
+  for (const auto& elem : coll) {
+    std::cout << elem << ' ';
+  }
+  std::cout << '\n';
+}
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+void testRandomAccess()
+{
+  std::vector<int> coll{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+  auto vw = coll | bel::views::stride(3);
+  print(vw);
+  check(vw.size() == 4 && std::ranges::distance(vw) == 4, "size()");
+  check(vw[0] == 0 && vw[1] == 3 && vw[3] == 9, "random access");
+  check(vw.end() - vw.begin() == 4, "iterator difference");
+  static_assert(std::ranges::random_access_range<decltype(vw)>);
+  static_assert(std::ranges::sized_range<decltype(vw)>);
+  static_assert(std::ranges::borrowed_range<decltype(vw)>);
+
+  // iterating backward from the end:
+  auto pos = vw.end();
+  --pos;
+  check(*pos == 9, "backward from the end");
+  pos -= 2;
+  check(*pos == 3, "operator-=");
+  check(*(vw.end() - 3) == 3, "operator- from the end");
+
+  // stride not dividing the size:
+  auto vw4 = coll | bel::views::stride(4);
+  check(vw4.size() == 3 && *(vw4.end() - 1) == 8, "stride not dividing the size");
+  check(std::ranges::equal(vw4 | std::views::reverse, std::vector{8, 4, 0}), "reverse iteration");
+
+  // propagates const:
+  const auto cvw = coll | bel::views::stride(3);
+  static_assert(!SupportsAssign<decltype(*cvw.begin()), int>);
+  static_assert(!SupportsAssign<decltype(cvw[0]), int>);
+  for (int& i : vw) {
+    i = -i;
+  }
+  check(coll[3] == -3 && coll[4] == 4, "modify elements");
+}
+
+
+void testStrided()
+{
+  // interleaved stereo samples (left, right, left, right, ...):
+  std::vector<double> samples(1000);
+  std::iota(samples.begin(), samples.end(), 0.0);
+
+  const auto left = samples | bel::views::stride(2);
+  const auto right = samples | bel::views::drop(1) | bel::views::stride(2);
+  check(left.size() == 500 && right.size() == 500, "channels");
+
+  // gather hook for kernels:
+  auto s = left.strided();
+  static_assert(std::same_as<decltype(s), bel::strided_span<const double>>);
+  double sum = 0;
+  for (std::size_t i = 0; i < s.size; ++i) {
+    sum += s.data[i * s.stride];
+  }
+  check(sum == std::accumulate(left.begin(), left.end(), 0.0), "strided() for kernels");
+  check(right.strided()[1] == 3.0 && right.strided().size == 500, "strided() of drop_view");
+
+  // concurrent iterations:
+  double sumLeft = 0, sumRight = 0;
+  {
+    std::jthread t{[&] { sumLeft = std::accumulate(left.begin(), left.end(), 0.0); }};
+    sumRight = std::accumulate(right.begin(), right.end(), 0.0);
+  }
+  check(sumLeft + sumRight == 999.0 * 1000 / 2, "concurrent iterations");
+}
+
+
+void testForward()
+{
+  std::list<int> coll{0, 1, 2, 3, 4, 5, 6, 7};
+  auto vw = coll | bel::views::stride(3);
+  print(vw);
+  check(vw.size() == 3, "size() of list");
+  check(std::ranges::equal(vw, std::vector{0, 3, 6}), "list elements");
+  check(*std::ranges::prev(std::ranges::next(vw.begin(), vw.end())) == 6, "backward iteration of list");
+  static_assert(std::ranges::bidirectional_range<decltype(vw)>);
+  static_assert(!std::ranges::random_access_range<decltype(vw)>);
+
+  auto vwPipe = coll | bel::views::filter([](int i) { return i % 2 == 0; })
+                     | bel::views::stride(2);
+  check(std::ranges::equal(vwPipe, std::vector{0, 4}), "stride of filter");
+}
+
+
+void testNonConstIterableBase()
+{
+  // underlying views that are not const-iterable (only the non-const view is usable):
+  std::vector<int> coll{1, 2, 3, 4, 5, 6, 7};
+  auto stdFilter = coll | std::views::filter([] (int i) { return i > 1; });
+  auto vw = stdFilter | bel::views::stride(2);
+  static_assert(!std::ranges::range<const decltype(vw)>);
+  std::vector<int> result;
+  for (int i : vw) {
+    result.push_back(i);
+  }
+  check(result == std::vector{2, 4, 6}, "stride over non-const-iterable views");
+}
+
+
+int main()
+{
+  testRandomAccess();
+  testStrided();
+  testForward();
+  testNonConstIterableBase();
+}
@@ -84,7 +84,7 @@ int main()
   
   print(coll2);
 
-  const auto& coll2_bel_cref = coll2 | bel::views::take(6);
+  [[maybe_unused]] const auto& coll2_bel_cref = coll2 | bel::views::take(6);
   //*coll2_bel_cref.begin() += 100;   // ERROR (good)
                                       //  no match for 'operator+=' (operand types are 'const std::complex<double>' and 'int')
   assert(std::is_const_v<std::remove_reference_t<decltype(*coll2_bel_cref.begin())>>);
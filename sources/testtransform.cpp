@@ -119,7 +119,7 @@ int main()
   //   error: no match for 'operator+=' (operand types are 'const int' and 'int')
   print(arr);
 
-  const auto& arr_bel_cref = arr | bel::views::take(6);
+  [[maybe_unused]] const auto& arr_bel_cref = arr | bel::views::take(6);
   // *arr_bel_cref.begin() += 100;   // ERROR (good)
                                       //  no match for 'operator+=' (operand types are 'const std::complex<double>' and 'int')
   assert(std::is_const_v<std::remove_reference_t<decltype(*arr_bel_cref.begin())>>);
@@ -258,5 +258,19 @@ int main()
   }
   //printPairs(vecPairs);
   print(cvBel);  
+
+  // functions without captures need no extra space:
+  {
+    std::vector vec{1, 2, 3, 4, 5, 6, 7, 8};
+    auto vAll = bel::views::all(vec);
+    auto vTrans = vec | bel::views::transform(square);
+    static_assert(sizeof(vTrans) == sizeof(vAll));
+    // functions with captures are still copy assignable:
+    int max = 5;
+    auto vTransCap1 = vec | bel::views::transform([max](int i) { return i * max; });
+    auto vTransCap2 = vTransCap1;
+    vTransCap2 = vTransCap1;
+    print(vTransCap2);
+  }
 }
 
@@ -0,0 +1,48 @@
+// <testutils.hpp> -*- C++ -*-
+//
+// Copyright (C) 2022 Nicolai Josuttis
+//
+// This file is part of the belleviews library.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU General Public License
+// as published by the Free Software Foundation; either version 3,
+// or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// Under Section 7 of GPL version 3, you are granted additional
+// permissions described in the GCC Runtime Library Exception, version
+// 3.1, as published by the Free Software Foundation.
+//
+// You should have received a copy of the GNU General Public License and
+// a copy of the GCC Runtime Library Exception along with this program;
+// see the files COPYING3 and COPYING.RUNTIME respectively.
+// If not, see <http://www.gnu.org/licenses/>.
+
+#ifndef TESTUTILS_HPP
+#define TESTUTILS_HPP
+
+#include <iostream>
+#include <string>
+
+//**********************************************************************
+// helpers for the test programs
+// - check() reports "OK:" or "TEST FAILED:"
+//   (ctest fails if a test reports "TEST FAILED")
+//**********************************************************************
+
+inline void check(bool ok, const std::string& what)
+{
+  if (ok) {
+    std::cerr << "OK: " << what << '\n';
+  }
+  else {
+    std::cerr << "TEST FAILED: " << what << '\n';
+  }
+}
+
+#endif // TESTUTILS_HPP
@@ -0,0 +1,135 @@
+#include <iostream>
+#include <vector>
+#include <list>
+#include <string>
+#include <thread>
+#include <numeric>
+#include <algorithm>
+#include <ranges>
+#include "belleviews.hpp"
+#include "testutils.hpp"
+
+
+template<typename T, typename T2>
+concept SupportsAssign = requires (T x, T2 y) { x = y; };
+
+
+void testColumns()
+{
+  // struct-of-arrays layout:
+  std::vector<int> ids{1, 2, 3, 4};
+  std::vector<double> prices{1.5, 2.5, 3.5, 4.5};
+  std::vector<std::string> names{"a", "b", "c", "d", "e"};
+
+  auto vw = bel::views::zip(ids, prices, names);
+  for (const auto& [id, price, name] : vw) {
+    std::cout << id << ": " << name << " " << price << '\n';
+  }
+  check(vw.size() == 4 && std::ranges::distance(vw) == 4, "size() is the size of the shortest range");
+  static_assert(std::ranges::random_access_range<decltype(vw)>);
+  static_assert(std::ranges::sized_range<decltype(vw)>);
+  static_assert(std::ranges::common_range<decltype(vw)>);
+  static_assert(std::ranges::borrowed_range<decltype(vw)>);
+
+  // random access:
+  auto [id2, price2, name2] = vw[2];
+  check(id2 == 3 && price2 == 3.5 && name2 == "c", "operator[]");
+  check(std::get<0>(*(vw.end() - 1)) == 4, "end() of ranges of different size");
+
+  // modify the elements:
+  for (auto [id, price, name] : vw) {
+    price *= 2;
+  }
+  check(prices[0] == 3.0 && prices[3] == 9.0, "modify elements via zip");
+
+  // the value type is a tuple of values:
+  std::ranges::range_value_t<decltype(vw)> val = vw[0];
+  std::get<0>(val) = 42;
+  check(ids[0] == 1, "value type is a copy");
+
+  // propagates const for all columns:
+  const auto cvw = bel::views::zip(ids, prices, names);
+  static_assert(!SupportsAssign<decltype(std::get<0>(*cvw.begin())), int>);
+  static_assert(!SupportsAssign<decltype(std::get<2>(cvw[0])), std::string>);
+  static_assert(SupportsAssign<decltype(std::get<0>(*vw.begin())), int>);
+
+  // columns as spans (no tuples per element):
+  auto [idCol, priceCol, nameCol] = cvw.columns();
+  static_assert(std::same_as<decltype(idCol), std::span<const int>>);
+  check(idCol.size() == 4 && nameCol.size() == 4 && priceCol.data() == prices.data(), "columns()");
+  double sum = 0;
+  for (std::size_t i = 0; i < priceCol.size(); ++i) {
+    sum += priceCol[i] * idCol[i];
+  }
+  check(sum == 3.0 * 1 + 5.0 * 2 + 7.0 * 3 + 9.0 * 4, "process columns");
+  auto [idColMod, priceColMod, nameColMod] = vw.columns();
+  static_assert(std::same_as<decltype(idColMod), std::span<int>>);
+
+  // algorithms:
+  auto pos = std::ranges::find_if(vw, [](const auto& t) { return std::get<2>(t) == "c"; });
+  check(pos - vw.begin() == 2, "find_if()");
+  check(std::ranges::count_if(cvw, [](const auto& t) { return std::get<1>(t) > 4.0; }) == 3, "count_if()");
+}
+
+
+void testOtherRanges()
+{
+  std::list<int> lst{1, 2, 3};
+  std::vector<char> vec{'a', 'b', 'c', 'd'};
+  auto vw = bel::views::zip(lst, vec);
+  static_assert(std::ranges::bidirectional_range<decltype(vw)>);
+  static_assert(!std::ranges::random_access_range<decltype(vw)>);
+  int num = 0;
+  for (auto [i, c] : vw) {
+    ++num;
+    c = static_cast<char>('A' + i - 1);
+  }
+  check(num == 3 && vec[2] == 'C' && vec[3] == 'd', "zip list and vector");
+  check(vw.size() == 3, "size()");
+
+  // zip of belle views:
+  auto vwPipe = bel::views::zip(lst | bel::views::filter([](int i) { return i % 2 == 1; }),
+                                vec | bel::views::drop(1));
+  check(std::ranges::distance(vwPipe) == 2, "zip of filter and drop");
+
+  // in pipelines:
+  auto vwTake = bel::views::zip(vec, vec) | bel::views::take(2);
+  check(std::ranges::distance(vwTake) == 2, "zip | take");
+}
+
+
+void testConcurrency()
+{
+  std::vector<int> a(10'000, 1);
+  std::vector<int> b(10'000, 2);
+  const auto vw = bel::views::zip(a, b);
+  long sum1 = 0, sum2 = 0;
+  {
+    std::jthread t{[&] {
+                     for (auto [x, y] : vw) sum1 += x * y;
+                   }};
+    for (auto [x, y] : vw) sum2 += x + y;
+  }
+  check(sum1 == 20'000 && sum2 == 30'000, "concurrent iterations");
+}
+
+
+void testNonConstIterableBase()
+{
+  // underlying views that are not const-iterable (only the non-const view is usable):
+  std::vector<int> coll{1, 2, 3, 4, 5};
+  std::vector<std::string> names{"a", "b", "c"};
+  auto stdFilter = coll | std::views::filter([] (int i) { return i > 1; });
+  auto vw = bel::views::zip(stdFilter, names);
+  static_assert(!std::ranges::range<const decltype(vw)>);
+  check(std::ranges::distance(vw) == 3 && std::get<0>(*vw.begin()) == 2, "zip with non-const-iterable views");
+}
+
+
+int main()
+{
+  testColumns();
+  testOtherRanges();
+  testConcurrency();
+  testNonConstIterableBase();
+}